@@ -55,8 +55,11 @@ import dpsctl.uframe as uframe
 from dpsctl.protocol import (create_cmd, create_enable_output, create_lock, create_set_calibration,
                              create_set_function, create_set_parameter, create_temperature, create_set_brightness,
                              create_set_baud, create_upgrade_data, create_upgrade_start, create_change_screen,
-                             unpack_cal_report, unpack_query_response, unpack_version_response,
-                             VALID_BAUD_RATES)
+                             create_history_read, unpack_cal_report, unpack_query_response, unpack_version_response,
+                             unpack_history_read_response, create_profile_read, unpack_profile_read_response,
+                             unpack_diagnostics_response, create_waveform_write, create_sequence_write,
+                             VALID_BAUD_RATES, WAVEFORM_MAX_POINTS, WAVEFORM_CHUNK_POINTS, WAVEFORM_PERSIST_POINTS,
+                             SEQUENCE_MAX_STEPS, SEQUENCE_CHUNK_STEPS, SEQUENCE_MAX_PASSES)
 
 try:
     import serial
@@ -441,6 +444,21 @@ def handle_response(command, frame, args, quiet=False):
         pass
     elif resp_command == protocol.CMD_SET_BRIGHTNESS:
         pass
+    elif resp_command == protocol.CMD_WAVEFORM_WRITE:
+        pass
+    elif resp_command == protocol.CMD_SEQUENCE_WRITE:
+        pass
+    elif resp_command == protocol.CMD_HISTORY_READ:
+        ret_dict = unpack_history_read_response(frame)
+    elif resp_command == protocol.CMD_PROFILE_READ:
+        ret_dict = unpack_profile_read_response(frame)
+    elif resp_command == protocol.CMD_DIAGNOSTICS:
+        data = unpack_diagnostics_response(frame)
+        print("Uptime:    {:d} s".format(data['uptime']))
+        print("CPU idle:  {:.1f} %".format(data['idle'] / 10))
+        print("Max busy:  {:d} us".format(data['max_busy']))
+        print("Wakeups:   {:d} /s".format(data['wakeups']))
+        print("Dropped:   {:d} high priority, {:d} UART events".format(data['high_overflows'], data['bulk_overflows']))
     elif resp_command == protocol.CMD_SET_BAUD:
         cmd = frame.unpack8()
         success = frame.unpack8()
@@ -538,6 +556,9 @@ def handle_commands(args):
     if args.version:
         communicate(comms, create_cmd(protocol.CMD_VERSION), args)
 
+    if args.diagnostics:
+        communicate(comms, create_cmd(protocol.CMD_DIAGNOSTICS), args)
+
     if args.calibration_report:
         data = communicate(comms, create_cmd(protocol.CMD_CAL_REPORT), args)
         print("Calibration Report:")
@@ -587,6 +608,18 @@ def handle_commands(args):
         else:
             fail("brightness must be between 0 and 100")
 
+    if args.waveform:
+        upload_waveform(comms, args)
+
+    if args.sequence:
+        upload_sequence(comms, args)
+
+    if args.download_history:
+        download_history(comms, args)
+
+    if args.profile:
+        print_profile(comms, args)
+
     if args.set_baud:
         if args.set_baud not in VALID_BAUD_RATES:
             fail("Invalid baud rate {:d}. Valid: {}".format(args.set_baud, VALID_BAUD_RATES))
@@ -689,6 +722,230 @@ def run_upgrade(comms, fw_file_name, args):
         fail("Device rejected firmware upgrade")
 
 
+# Must match the log format in opendps/history.c
+HISTORY_WORDS_PER_PAGE = 256
+
+
+def sign_extend(value, bits):
+    """
+    Sign extend a two's complement value of the given bit width
+    """
+    if value & (1 << (bits - 1)):
+        value -= 1 << bits
+    return value
+
+
+def decode_history(words, first_pos, interval):
+    """
+    Decode history log words starting at log position first_pos into a list
+    of samples (pos, session, uptime, v_out, i_out, v_in, energy) with voltages
+    in mV, current in mA and energy in mWh
+    """
+    samples = []
+    session = 0
+    uptime = None
+    valid = False
+    v_out = i_out = v_in = 0
+    energy = None
+    for pos, w in enumerate(words, first_pos):
+        tag = w >> 28
+        if w & 0x80000000 == 0:
+            if valid:
+                v_out += 10 * sign_extend((w >> 20) & 0x7ff, 11)
+                i_out += sign_extend((w >> 9) & 0x7ff, 11)
+                v_in += 10 * sign_extend(w & 0x1ff, 9)
+                samples.append((pos, session, uptime, v_out, i_out, v_in, energy))
+                uptime += interval
+        elif tag == 0xa:
+            new_uptime = w & 0x0fffffff
+            if uptime is None or new_uptime < uptime - interval:
+                # Uptime went backwards, the device was restarted
+                session += 1
+            uptime = new_uptime
+            valid = False
+        elif tag == 0xc and uptime is not None:
+            v_out = 10 * ((w >> 15) & 0x1fff)
+            i_out = w & 0x7fff
+            valid = True
+            samples.append((pos, session, uptime, v_out, i_out, v_in, energy))
+            uptime += interval
+        elif tag == 0xd:
+            v_in = 10 * (w & 0x1fff)
+        elif tag == 0xe:
+            energy = w & 0x0fffffff
+        # Page headers (0xb), erased and torn words (0xf) are skipped
+    return samples
+
+
+def download_history(comms, args):
+    """
+    Download the measurement history log and write it as CSV. The download
+    starts at the page holding the position given by --history-from so
+    delta samples can be decoded, and only samples from that position on
+    are written.
+    """
+    start = args.history_from if args.history_from else 0
+    offset = start - start % HISTORY_WORDS_PER_PAGE
+    words = []
+    first_pos = None
+    head = offset + 1
+    while offset < head:
+        data = communicate(comms, create_history_read(offset), args, quiet=True)
+        head = data['head']
+        if first_pos is None or data['offset'] != first_pos + len(words):
+            # The log wrapped or skipped a lost page, restart decoding there
+            first_pos = data['offset']
+            words = []
+        words += data['words']
+        offset = data['offset'] + len(data['words'])
+        if len(data['words']) == 0 and data['offset'] < head:
+            offset = data['offset'] + HISTORY_WORDS_PER_PAGE - data['offset'] % HISTORY_WORDS_PER_PAGE
+        sys.stdout.write("\rDownloaded {:d} words".format(len(words)))
+        sys.stdout.flush()
+    print("")
+
+    samples = [s for s in decode_history(words, first_pos if first_pos else 0, data['interval']) if s[0] >= start]
+    # Samples of the last session can be mapped to wall clock time
+    last_session = samples[-1][1] if samples else 0
+    now = time.time()
+    with open(args.download_history, "w") as f:
+        f.write("position,session,uptime_s,time,v_out_v,i_out_a,v_in_v,energy_wh\n")
+        for pos, session, uptime, v_out, i_out, v_in, energy in samples:
+            timestamp = ""
+            if session == last_session:
+                timestamp = time.strftime("%Y-%m-%d %H:%M:%S", time.localtime(now - (data['uptime'] - uptime)))
+            f.write("{:d},{:d},{:d},{},{:.2f},{:.3f},{:.2f},{}\n".format(
+                pos, session, uptime, timestamp, v_out / 1000, i_out / 1000, v_in / 1000,
+                "{:.3f}".format(energy / 1000) if energy is not None else ""))
+    print("Wrote {:d} samples to {}".format(len(samples), args.download_history))
+    print("Resume with --history-from {:d}".format(head))
+
+
+def read_waveform(filename):
+    """
+    Read an arbitrary waveform from a CSV file holding one point in mV per
+    line. The last column is used if there are several, lines that are not
+    numbers such as a header are skipped.
+    """
+    points = []
+    with open(filename) as f:
+        for line in f:
+            field = line.strip().split(",")[-1].strip()
+            try:
+                points.append(int(round(float(field))))
+            except ValueError:
+                continue
+    if len(points) < 2 or len(points) > WAVEFORM_MAX_POINTS:
+        fail("a waveform has 2 to {:d} points, {} has {:d}".format(WAVEFORM_MAX_POINTS, filename, len(points)))
+    for point in points:
+        if point < 0 or point > 0xffff:
+            fail("waveform point {:d} mV is out of range".format(point))
+    return points
+
+
+def upload_waveform(comms, args):
+    """
+    Upload the arbitrary waveform of the function generator. With
+    --sample-period the function generator frequency is set to play one
+    point per period and the arbitrary waveform is selected.
+    """
+    points = read_waveform(args.waveform)
+    if args.waveform_persist and len(points) > WAVEFORM_PERSIST_POINTS:
+        fail("only waveforms of up to {:d} points can be stored in flash".format(WAVEFORM_PERSIST_POINTS))
+    for offset in range(0, len(points), WAVEFORM_CHUNK_POINTS):
+        chunk = points[offset:offset + WAVEFORM_CHUNK_POINTS]
+        communicate(comms, create_waveform_write(len(points), offset, chunk, args.waveform_persist), args, quiet=True)
+    print("Uploaded {:d} points{}".format(len(points), " to flash" if args.waveform_persist else ""))
+    if args.sample_period:
+        # The function generator frequency is in dHz
+        freq = int(round(1e7 / (len(points) * args.sample_period)))
+        if freq < 1:
+            fail("sample period is too long for {:d} points".format(len(points)))
+        communicate(comms, create_set_parameter(["freq={:d}".format(freq), "func=3"]), args)
+
+
+def read_sequence(filename):
+    """
+    Read a sequence program from a CSV file with one step per line:
+    mV,mA,duration_ms[,ramp[,loop_to,loop_count]]. ramp is 1 to ramp from the
+    previous step, a step with a loop_count jumps back to step loop_to
+    (counted from 1) that many times. Lines that do not start with a number
+    such as a header are skipped.
+    """
+    steps = []
+    with open(filename) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split(",")]
+            try:
+                values = [int(field) for field in fields if field != ""]
+            except ValueError:
+                continue
+            if len(values) not in (3, 4, 6):
+                fail("a step is mV,mA,duration_ms[,ramp[,loop_to,loop_count]]: {}".format(line.strip()))
+            mv, ma, duration = values[:3]
+            ramp = values[3] if len(values) > 3 else 0
+            loop_to, loop_count = (values[4] - 1, values[5]) if len(values) > 4 else (0, 0)
+            if duration < 1 or (loop_count and not 0 <= loop_to <= len(steps)):
+                fail("invalid step {:d}: {}".format(len(steps) + 1, line.strip()))
+            steps.append((mv, ma, duration, ramp, loop_to, loop_count))
+    if len(steps) < 1 or len(steps) > SEQUENCE_MAX_STEPS:
+        fail("a sequence has 1 to {:d} steps, {} has {:d}".format(SEQUENCE_MAX_STEPS, filename, len(steps)))
+    return steps
+
+
+def upload_sequence(comms, args):
+    """
+    Upload a program for the sequence function. The program is started by
+    enabling the output of the seq function, the progress can be followed
+    with --query.
+    """
+    steps = read_sequence(args.sequence)
+    if args.passes < 0 or args.passes > SEQUENCE_MAX_PASSES:
+        fail("passes is 0 (until stopped) to {:d}".format(SEQUENCE_MAX_PASSES))
+    for index in range(0, len(steps), SEQUENCE_CHUNK_STEPS):
+        chunk = steps[index:index + SEQUENCE_CHUNK_STEPS]
+        communicate(comms, create_sequence_write(len(steps), index, chunk, args.passes), args, quiet=True)
+    print("Uploaded {:d} steps".format(len(steps)))
+
+
+# Must match profile_kind_t in opendps/profile.h
+PROFILE_KINDS = ["draw", "tick", "tft_putch", "tft_puts", "tft_blit", "tft_blit_rle"]
+PROFILE_NO_ITEM = 0xff
+
+
+def print_profile(comms, args):
+    """
+    Read and print the UI profile counters of firmware built with
+    PROFILE_ENABLE=1. The counters are cleared after reading when
+    --profile-clear is given.
+    """
+    entries = []
+    index = 0
+    total = 1
+    while index < total:
+        data = communicate(comms, create_profile_read(index, False), args, quiet=True)
+        if not data:
+            fail("no profile counters, is the firmware built with PROFILE_ENABLE=1?")
+        total = data['total']
+        entries += data['entries']
+        if not data['entries']:
+            break
+        index += len(data['entries'])
+    if args.profile_clear:
+        communicate(comms, create_profile_read(0, True), args, quiet=True)
+
+    cycles_per_us = data['cycles_per_second'] / 1000000
+    print("{:<12} {:>4} {:<12} {:>8} {:>12} {:>9} {:>10} {:>8}".format(
+        "screen", "item", "kind", "calls", "total us", "us/call", "bytes", "B/call"))
+    for e in entries:
+        kind = PROFILE_KINDS[e['kind']] if e['kind'] < len(PROFILE_KINDS) else str(e['kind'])
+        item = "" if e['item'] == PROFILE_NO_ITEM else str(e['item'])
+        calls = e['calls'] if e['calls'] else 1
+        us = e['cycles'] / cycles_per_us
+        print("{:<12} {:>4} {:<12} {:>8d} {:>12.0f} {:>9.1f} {:>10d} {:>8.0f}".format(
+            e['screen'], item, kind, e['calls'], us, us / calls, e['bytes'], e['bytes'] / calls))
+
+
 def best_fit(X, Y):
     """
     Calculate linear line of best fit coefficients (y = kx + c)
@@ -1232,6 +1489,16 @@ def main():
     parser.add_argument('-U', '--upgrade', type=str, dest="firmware", help="Perform upgrade of OpenDPS firmware")
     parser.add_argument('--screen', type=str, dest="switch_screen", help="Switch to 'settings' or 'main' screen")
     parser.add_argument('--force', action='store_true', help="Force upgrade even if dpsctl complains about the firmware")
+    parser.add_argument('--download-history', type=str, dest="download_history", help="Download the measurement history log to a CSV file")
+    parser.add_argument('--history-from', type=int, dest="history_from", default=0, help="Log position to resume a history download from")
+    parser.add_argument('--waveform', type=str, help="Upload an arbitrary waveform for the function generator from a CSV file of points in mV")
+    parser.add_argument('--waveform-persist', action='store_true', dest="waveform_persist", help="Store the uploaded waveform in flash, up to 128 points")
+    parser.add_argument('--sample-period', type=float, dest="sample_period", help="Play the uploaded waveform with this time between points (us)")
+    parser.add_argument('--sequence', type=str, help="Upload a program for the seq function from a CSV file of mV,mA,duration_ms[,ramp[,loop_to,loop_count]] steps")
+    parser.add_argument('--passes', type=int, default=1, help="Number of times the uploaded sequence is run, 0 runs it until stopped")
+    parser.add_argument('--diagnostics', action='store_true', help="Print the CPU idle time and the main loop latency")
+    parser.add_argument('--profile', action='store_true', help="Print the UI draw time and display traffic counters")
+    parser.add_argument('--profile-clear', action='store_true', dest="profile_clear", help="Clear the UI profile counters after printing them")
     if testing:
         parser.add_argument('-t', '--temperature', type=str, dest="temperature", help="Send temperature report (for testing)")
 
@@ -50,6 +50,11 @@ CMD_CLEAR_CALIBRATION = 20
 CMD_CHANGE_SCREEN = 21
 CMD_SET_BRIGHTNESS = 22
 CMD_SET_BAUD = 23
+CMD_HISTORY_READ = 24
+CMD_PROFILE_READ = 25
+CMD_DIAGNOSTICS = 26
+CMD_WAVEFORM_WRITE = 27
+CMD_SEQUENCE_WRITE = 28
 CMD_RESPONSE = 0x80
 
 # wifi_status_t
@@ -72,6 +77,16 @@ UPGRADE_SUCCESS = 16
 CHANGE_SCREEN_MAIN = 0
 CHANGE_SCREEN_SETTINGS = 1
 
+# cmd_waveform_write, must match opendps/func_gen.h
+WAVEFORM_MAX_POINTS = 256
+WAVEFORM_CHUNK_POINTS = 27
+WAVEFORM_PERSIST_POINTS = 128
+
+# cmd_sequence_write, must match opendps/sequence.h
+SEQUENCE_MAX_STEPS = 32
+SEQUENCE_CHUNK_STEPS = 4
+SEQUENCE_MAX_PASSES = 9999
+
 # ########################################################################## #
 # Helpers for creating frames.
 # Each function returns a complete frame ready for transmission.
@@ -231,6 +246,57 @@ def create_set_baud(baud):
     return f
 
 
+def create_history_read(offset):
+    f = uFrame()
+    f.pack8(CMD_HISTORY_READ)
+    f.pack32(offset)
+    f.end()
+    return f
+
+
+def create_waveform_write(num_points, offset, points, persist):
+    f = uFrame()
+    f.pack8(CMD_WAVEFORM_WRITE)
+    f.pack16(num_points)
+    f.pack16(offset)
+    f.pack8(len(points))
+    f.pack8(1 if persist else 0)
+    for point in points:
+        f.pack16(point)
+    f.end()
+    return f
+
+
+def create_sequence_write(num_steps, index, steps, passes):
+    """
+    steps is a list of (mv, ma, duration_ms, ramp, loop_to, loop_count)
+    """
+    f = uFrame()
+    f.pack8(CMD_SEQUENCE_WRITE)
+    f.pack8(num_steps)
+    f.pack8(index)
+    f.pack8(len(steps))
+    f.pack16(passes)
+    for mv, ma, duration, ramp, loop_to, loop_count in steps:
+        f.pack16(mv)
+        f.pack16(ma)
+        f.pack32(duration)
+        f.pack8(1 if ramp else 0)
+        f.pack8(loop_to)
+        f.pack16(loop_count)
+    f.end()
+    return f
+
+
+def create_profile_read(index, clear):
+    f = uFrame()
+    f.pack8(CMD_PROFILE_READ)
+    f.pack8(index)
+    f.pack8(1 if clear else 0)
+    f.end()
+    return f
+
+
 # ########################################################################## #
 # Helpers for unpacking frames.
 #
@@ -377,3 +443,59 @@ def unpack_version_response(uframe):
     data['boot_git_hash'] = uframe.unpack_cstr()
     data['app_git_hash'] = uframe.unpack_cstr()
     return data
+
+
+def unpack_history_read_response(uframe):
+    """
+    Returns a dictionary of the frame contents
+    """
+    data = {}
+    data['command'] = uframe.unpack8()
+    data['status'] = uframe.unpack8()
+    data['interval'] = uframe.unpack16()
+    data['uptime'] = uframe.unpack32()
+    data['head'] = uframe.unpack32()
+    data['offset'] = uframe.unpack32()
+    count = uframe.unpack8()
+    data['words'] = [uframe.unpack32() for _ in range(count)]
+    return data
+
+
+def unpack_diagnostics_response(uframe):
+    """
+    Returns a dictionary of the frame contents
+    """
+    data = {}
+    data['command'] = uframe.unpack8()
+    data['status'] = uframe.unpack8()
+    data['idle'] = uframe.unpack16()
+    data['max_busy'] = uframe.unpack32()
+    data['wakeups'] = uframe.unpack32()
+    data['uptime'] = uframe.unpack32()
+    data['high_overflows'] = uframe.unpack32()
+    data['bulk_overflows'] = uframe.unpack32()
+    return data
+
+
+def unpack_profile_read_response(uframe):
+    """
+    Returns a dictionary of the frame contents
+    """
+    data = {}
+    data['command'] = uframe.unpack8()
+    data['status'] = uframe.unpack8()
+    data['cycles_per_second'] = uframe.unpack32()
+    data['total'] = uframe.unpack8()
+    data['index'] = uframe.unpack8()
+    count = uframe.unpack8()
+    data['entries'] = []
+    for _ in range(count):
+        entry = {}
+        entry['kind'] = uframe.unpack8()
+        entry['item'] = uframe.unpack8()
+        entry['calls'] = uframe.unpack32()
+        entry['cycles'] = uframe.unpack32()
+        entry['bytes'] = uframe.unpack32()
+        entry['screen'] = uframe.unpack_cstr()
+        data['entries'].append(entry)
+    return data
@@ -35,6 +35,7 @@
 #include "dpsemul.h"
 #include "flash.h"
 #include "event.h"
+#include "rxframe.h"
 #include "tft.h"
 #include "dbg_printf.h"
 #include "uframe.h"
@@ -105,9 +106,7 @@ void* comm_thread(void *arg)
         }
         printf("[Com] Received %lu bytes\n", recv_len);
         for (int i = 0; i < recv_len; i++) {
-            if (!event_put(event_uart_rx, buf[i])) {
-                dbg_printf("Error: event queue overflowed\n");
-            }
+            rxframe_put_char(buf[i]);
         }
     }
     
@@ -157,6 +156,10 @@ void* event_thread(void *arg)
             printf("Drawing UI\n");
             emul_tft_draw();
             printf("---\n");
+        } else if (strcmp("stats", buf) == 0) {
+            emul_tft_stats();
+        } else if (strncmp("ppm", buf, 3) == 0) {
+            (void) emul_tft_save_ppm(buf[3] == ' ' ? &buf[4] : "dpsemu.ppm");
         }
     }
     
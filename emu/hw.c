@@ -25,6 +25,28 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <time.h>
+#include "event.h"
+
+static uint64_t load_start;
+static uint64_t load_idle;
+static uint64_t load_max_busy;
+static uint32_t load_wakeups;
+static uint64_t busy_start;
+static uint16_t idle_permille;
+static uint32_t max_busy_us;
+static uint32_t wakeups_per_second;
+
+/**
+  * @brief Get the time for the load measurement
+  * @retval monotonic time in ns
+  */
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
 
 /**
   * @brief Initialize the hardware
@@ -48,6 +70,14 @@ void hw_get_adc_values(uint16_t *i_out_raw, uint16_t *v_in_raw, uint16_t *v_out_
     *v_out_raw = 0;
 }
 
+/**
+  * @brief Acknowledge an event_measurement
+  * @retval none
+  */
+void hw_ack_measurement(void)
+{
+}
+
 /**
   * @brief Initialize TIM4 that drives the backlight of the TFT
   * @retval None
@@ -66,11 +96,50 @@ uint16_t hw_get_itrig_ma(void)
 }
 
 /**
-  * @brief Check if it current press is a long press, inject event if so
+  * @brief Sleep for 1ms unless an event is pending, the emulator has no
+  *        interrupts to wake it up
+  * @retval None
+  */
+void hw_idle(void)
+{
+    uint64_t now = now_ns();
+    if (!load_start) {
+        load_start = busy_start = now;
+    }
+    if (!event_pending()) {
+        if (now - busy_start > load_max_busy) {
+            load_max_busy = now - busy_start;
+        }
+        struct timespec delay = { 0, 1000000 };
+        nanosleep(&delay, NULL);
+        busy_start = now_ns();
+        load_idle += busy_start - now;
+        load_wakeups++;
+    }
+    if (busy_start - load_start >= 1000000000) {
+        uint64_t window = busy_start - load_start;
+        idle_permille = load_idle * 1000 / window;
+        max_busy_us = load_max_busy / 1000;
+        wakeups_per_second = (uint64_t) load_wakeups * 1000000000 / window;
+        load_start = busy_start;
+        load_idle = 0;
+        load_max_busy = 0;
+        load_wakeups = 0;
+    }
+}
+
+/**
+  * @brief Get the CPU load of the last second
+  * @param idle (out) time spent sleeping in hw_idle() in 0.1%
+  * @param max_busy (out) the longest time between two sleeps in us
+  * @param wakeups (out) number of wakeups per second
   * @retval None
   */
-void hw_longpress_check(void)
+void hw_get_load(uint16_t *idle, uint32_t *max_busy, uint32_t *wakeups)
 {
+    *idle = idle_permille;
+    *max_busy = max_busy_us;
+    *wakeups = wakeups_per_second;
 }
 
 /**
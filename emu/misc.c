@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
+#include "tick.h"
 
 char  _bootcom_start[16];
 
@@ -10,9 +12,21 @@ void scb_reset_system(void)
 	printf("scb_reset_system!\n");
 }
 
-uint32_t get_ticks(void)
+uint64_t get_ticks_us(void)
 {
-	return 0;
+	static uint64_t start;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64_t now = (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	if (!start) {
+		start = now;
+	}
+	return now - start;
+}
+
+uint64_t get_ticks(void)
+{
+	return get_ticks_us() / 1000;
 }
 
 void delay_ms(uint32_t t)
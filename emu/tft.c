@@ -26,12 +26,148 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include "tft.h"
+#include "ili9163c.h"
+#include "font-full_small.h"
+#include "font-meter_small.h"
+#include "font-meter_medium.h"
+#include "font-meter_large.h"
+#include "gfx_lookup.h"
+#include "spi_driver.h"
+#include "profile.h"
 
 #define TFT_WIDTH   128
 #define TFT_HEIGHT  128
+
+/** GRAM size of the DPS display, the firmware clears more than is visible */
+#define GRAM_WIDTH  128
+#define GRAM_HEIGHT 160
+
+/** Bytes sent to the display for setting a window: column address, page
+    address and memory write commands with their arguments */
+#define WINDOW_BYTES  (5 + 5 + 1)
+
+#ifndef COLORSPACE
+ #define COLORSPACE 0
+#endif // COLORSPACE
+
+#define ILI9163C_COLORSPACE_TWIDDLE(color) \
+        (((COLORSPACE) == 0) \
+            ? (((color) & 0xF800) >> 11) | ((color) & 0x07E0) | (((color) & 0x001F) << 11) \
+            : (color))
+
+/** First character of each glyph drawn by tft_putch, for emul_tft_draw */
 uint8_t tft[TFT_WIDTH][TFT_HEIGHT];
 
+/** The pixels as written to the display, in bgr565 format */
+static uint16_t framebuffer[TFT_HEIGHT][TFT_WIDTH];
+
+/** The current display window and write position */
+static uint32_t win_x0, win_y0, win_x1, win_y1;
+static uint32_t win_x, win_y;
+
+/** Scroll start as sent to the display controller */
+static uint32_t scroll_lines;
+static bool is_inverted;
+static uint32_t generation = 1;
+
+/** Drawing counters, in total and at the last call to emul_tft_stats and
+    emul_tft_save_ppm */
+static uint32_t glyph_count;
+static uint32_t pixel_count;
+static uint32_t byte_count;
+static uint32_t last_glyph_count;
+static uint32_t last_stats_pixel_count;
+static uint32_t last_stats_byte_count;
+static uint32_t last_frame_pixel_count;
+static uint32_t last_frame_byte_count;
+static struct timespec last_stats_time;
+
+/** Buffer for decoding glyphs */
+static uint16_t glyph_buffer[((4*FONT_METER_LARGE_MAX_GLYPH_WIDTH*FONT_METER_LARGE_MAX_GLYPH_HEIGHT)+3)/4];
+
+/**
+ * @brief Set the display window as ili9163c_set_window does
+ * @param x0 y0 top left corner
+ * @param x1 y1 bottom right corner
+ * @retval none
+ */
+static void set_window(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+    win_x0 = win_x = x0;
+    win_y0 = win_y = y0;
+    win_x1 = x1;
+    win_y1 = y1;
+    byte_count += WINDOW_BYTES;
+}
+
+/**
+ * @brief Write pixels at the window position, wrapping like the display
+ *        controller does. Pixels outside of the display are dropped.
+ * @param color the pixel
+ * @param count number of pixels
+ * @retval none
+ */
+static void push_colors(uint16_t color, uint32_t count)
+{
+    pixel_count += count;
+    byte_count += 2 * count;
+    while (count--) {
+        if (win_x < TFT_WIDTH && win_y < TFT_HEIGHT) {
+            framebuffer[win_y][win_x] = color;
+        }
+        if (++win_x > win_x1) {
+            win_x = win_x0;
+            if (++win_y > win_y1) {
+                win_y = win_y0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Write pixels in native byte order at the window position
+ * @param pixels the pixels
+ * @param count number of pixels
+ * @retval none
+ */
+static void push_pixels(const uint16_t *pixels, uint32_t count)
+{
+    while (count--) {
+        push_colors(*pixels++, 1);
+    }
+}
+
+/**
+ * @brief Write pixels stored as big endian bytes at the window position
+ * @param data the pixel bytes
+ * @param count number of pixels
+ * @retval none
+ */
+static void push_bytes(const uint8_t *data, uint32_t count)
+{
+    while (count--) {
+        push_colors((data[0] << 8) | data[1], 1);
+        data += 2;
+    }
+}
+
+/**
+ * @brief Get a pixel as shown on the display, with scrolling and inversion
+ * @param x y display position
+ * @retval the pixel in bgr565 format
+ */
+static uint16_t display_pixel(uint32_t x, uint32_t y)
+{
+    /** The controller shows GRAM line (line + scroll_lines) at display line
+        line. With the DPS rotation the lines run from right to left across
+        the display, so column x is line TFT_WIDTH-1 - x. */
+    uint32_t line = (TFT_WIDTH - 1 - x + scroll_lines) % TFT_WIDTH;
+    uint16_t pixel = framebuffer[y][TFT_WIDTH - 1 - line];
+    return is_inverted ? ~pixel : pixel;
+}
+
 /**
  * @brief Draw the tft on stdout
  * @retval none
@@ -60,12 +196,73 @@ void emul_tft_draw(void)
     }
 }
 
+/**
+ * @brief Print the number of glyphs, pixels and bytes drawn since the last
+ *        call and the glyph rate
+ * @retval none
+ */
+void emul_tft_stats(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double elapsed = (now.tv_sec - last_stats_time.tv_sec) + (now.tv_nsec - last_stats_time.tv_nsec) / 1e9;
+    uint32_t glyphs = glyph_count - last_glyph_count;
+    printf("Glyphs drawn: %u total, %u in %.1f s (%.1f glyphs/s)\n", glyph_count, glyphs, elapsed, elapsed > 0 ? glyphs / elapsed : 0);
+    printf("Sent to display: %u pixels, %u bytes in %.1f s\n", pixel_count - last_stats_pixel_count, byte_count - last_stats_byte_count, elapsed);
+    last_glyph_count = glyph_count;
+    last_stats_pixel_count = pixel_count;
+    last_stats_byte_count = byte_count;
+    last_stats_time = now;
+}
+
+/**
+ * @brief The emulated display stands in for the SPI driver, for the profiler
+ * @retval the number of bytes sent to the display, wraps at 2^32
+ */
+uint32_t spi_dma_bytes_queued(void)
+{
+    return byte_count;
+}
+
+/**
+ * @brief Save the display as a binary PPM image and print the number of
+ *        pixels and bytes sent to the display since the last saved frame
+ * @param file_name the image file
+ * @retval true if the image was saved
+ */
+bool emul_tft_save_ppm(const char *file_name)
+{
+    FILE *f = fopen(file_name, "wb");
+    if (!f) {
+        printf("Error: could not open %s\n", file_name);
+        return false;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+    for (uint32_t y = 0; y < TFT_HEIGHT; y++) {
+        for (uint32_t x = 0; x < TFT_WIDTH; x++) {
+            uint16_t pixel = display_pixel(x, y);
+            uint8_t rgb[3] = {
+                (uint8_t) ((pixel & 0x1f) * 255 / 31),
+                (uint8_t) (((pixel >> 5) & 0x3f) * 255 / 63),
+                (uint8_t) ((pixel >> 11) * 255 / 31),
+            };
+            fwrite(rgb, sizeof(rgb), 1, f);
+        }
+    }
+    fclose(f);
+    printf("Saved %s, frame sent %u pixels, %u bytes\n", file_name, pixel_count - last_frame_pixel_count, byte_count - last_frame_byte_count);
+    last_frame_pixel_count = pixel_count;
+    last_frame_byte_count = byte_count;
+    return true;
+}
+
 /**
   * @brief Initialize the TFT module
   * @retval none
   */
 void tft_init(void)
 {
+    clock_gettime(CLOCK_MONOTONIC, &last_stats_time);
     tft_clear();
 }
 
@@ -76,6 +273,123 @@ void tft_init(void)
 void tft_clear(void)
 {
     memset(tft, 0, sizeof(tft));
+    tft_scroll(0);
+    /** Like ili9163c_fill_screen */
+    set_window(0, 0, GRAM_WIDTH+2, GRAM_HEIGHT);
+    push_colors(BLACK, (GRAM_WIDTH+2) * GRAM_HEIGHT);
+    tft_invalidate();
+}
+
+/**
+  * @brief Tell items caching what they have drawn that the screen has been
+  *        overwritten and needs a full redraw
+  * @retval none
+  */
+void tft_invalidate(void)
+{
+    generation++;
+}
+
+/**
+  * @brief Get the screen generation, which changes on every tft_invalidate
+  * @retval the generation (never 0)
+  */
+uint32_t tft_get_generation(void)
+{
+    return generation;
+}
+
+/**
+  * @brief Check if an icon spot needs to be sent to the display because the
+  *        icon changed or the screen was invalidated since it was drawn.
+  *        If so the spot is recorded as drawn and the caller must draw it.
+  * @param spot the icon spot
+  * @param icon the icon that should be shown, NULL for a blank spot
+  * @retval true if the icon must be drawn
+  */
+bool tft_icon_changed(tft_icon_spot_t *spot, const uint16_t *icon)
+{
+    if (spot->generation == generation && spot->icon == icon) {
+        return false;
+    }
+    spot->icon = icon;
+    spot->generation = generation;
+    return true;
+}
+
+/**
+  * @brief Decode 2bpp glyph to TFT-native bgr565 format
+  * @param target the target buffer
+  * @param target_size size of the target buffer in bytes, wiped for spaces
+  * @param pixdata the input bytes from the font definition
+  * @param nbytes number of bytes in the source glyph array
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval none
+  */
+static void decode_glyph(uint16_t *target, size_t target_size, const uint8_t *pixdata, size_t nbytes, bool invert, uint16_t color)
+{
+    if (nbytes == 0) { /* we're attempting to draw a space */
+        memset(target, (invert ? WHITE : BLACK) & 0xFF, target_size);
+        return;
+    }
+    uint32_t color_mask = 0xffffffff;
+    if (!invert && color != WHITE) {
+        color_mask = ((uint32_t) ILI9163C_COLORSPACE_TWIDDLE(color) << 16) | ILI9163C_COLORSPACE_TWIDDLE(color);
+        if (is_inverted) {
+            color_mask = ~color_mask;
+        }
+    }
+    for (size_t i = 0; i < nbytes; ++i) {
+        uint32_t lo = mono2bpp_lookup[pixdata[i] & 0xF];
+        uint32_t hi = mono2bpp_lookup[pixdata[i] >> 4];
+        if (invert) {
+            lo = ~lo;
+            hi = ~hi;
+        }
+        lo &= color_mask;
+        hi &= color_mask;
+        /** The words are laid out as on the little endian target */
+        *target++ = lo & 0xffff;
+        *target++ = lo >> 16;
+        *target++ = hi & 0xffff;
+        *target++ = hi >> 16;
+    }
+}
+
+/**
+  * @brief Decode 2bpp glyph to TFT-native bgr565 format into the glyph buffer
+  * @param pixdata the input bytes from the font definition
+  * @param nbytes number of bytes in the source glyph array
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval none
+  */
+void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16_t color)
+{
+    decode_glyph(glyph_buffer, sizeof(glyph_buffer), pixdata, nbytes, invert, color);
+}
+
+/**
+  * @brief Decode a glyph and write it at the window position
+  * @param size font size
+  * @param ch the character
+  * @param num_pixels number of pixels in the glyph
+  * @param invert whether to invert the glyph
+  * @param color color of the glyph
+  * @retval none
+  */
+static void draw_glyph(tft_font_size_t size, char ch, uint32_t num_pixels, bool invert, uint16_t color)
+{
+    const uint8_t *pixdata;
+    uint32_t nbytes;
+    tft_get_glyph_pixdata(size, ch, &pixdata, &nbytes);
+    tft_decode_glyph(pixdata, nbytes, invert, color);
+    if (num_pixels > sizeof(glyph_buffer) / sizeof(uint16_t)) {
+        num_pixels = sizeof(glyph_buffer) / sizeof(uint16_t);
+    }
+    push_pixels(glyph_buffer, num_pixels);
+    glyph_count++;
 }
 
 /**
@@ -89,35 +403,184 @@ void tft_clear(void)
   */
 void tft_blit(uint16_t *bits, uint32_t width, uint32_t height, uint32_t x, uint32_t y)
 {
-    (void) bits;
-    (void) width;
-    (void) height;
-    (void) x;
-    (void) y;
+    PROFILE_START(profile, profile_blit, NULL, PROFILE_NO_ITEM);
+    set_window(x, y, x + width-1, y + height-1);
+    push_bytes((uint8_t*) bits, width*height);
+    PROFILE_STOP(profile);
+}
+
+/**
+  * @brief Blit run length encoded graphics on TFT
+  * @param rle the encoded graphics, width*height pixels
+  * @param width width of data
+  * @param height of data
+  * @param x x position
+  * @param y y position
+  * @retval none
+  */
+void tft_blit_rle(const uint16_t *rle, uint32_t width, uint32_t height, uint32_t x, uint32_t y)
+{
+    uint32_t remaining = width * height;
+    PROFILE_START(profile, profile_blit_rle, NULL, PROFILE_NO_ITEM);
+    set_window(x, y, x + width-1, y + height-1);
+    while (remaining) {
+        uint32_t count = *rle & TFT_RLE_MAX_COUNT;
+        if (count == 0 || count > remaining) {
+            printf("Error: bad RLE packet 0x%04x\n", *rle);
+            break;
+        }
+        if (*rle & TFT_RLE_RUN) {
+            push_colors(rle[1], count);
+            rle += 2;
+        } else {
+            push_pixels(&rle[1], count);
+            rle += 1 + count;
+        }
+        remaining -= count;
+    }
+    PROFILE_STOP(profile);
+}
+
+/**
+  * @brief Determine glyph spacing given the font size
+  * @param size font size
+  * @retval the spacing
+  */
+uint8_t tft_get_glyph_spacing(tft_font_size_t size)
+{
+    switch(size) {
+        case FONT_FULL_SMALL:
+            return FONT_FULL_SMALL_SPACING;
+        case FONT_METER_SMALL:
+            return FONT_METER_SMALL_SPACING;
+        case FONT_METER_MEDIUM:
+            return FONT_METER_MEDIUM_SPACING;
+        case FONT_METER_LARGE:
+            return FONT_METER_LARGE_SPACING;
+        default:
+            return 0;
+    }
+}
+
+/**
+  * @brief Determine glyph metrics given the supplied character and font size
+  * @param size font size
+  * @param ch the character (must be a supported character)
+  * @param glyph_width (out) the width in pixels of the character
+  * @param glyph_height (out) the height in pixels of the character
+  * @retval none
+  */
+void tft_get_glyph_metrics(tft_font_size_t size, char ch, uint32_t *glyph_width, uint32_t *glyph_height)
+{
+    size_t idx = ch - 0x20;
+    switch(size) {
+        case FONT_FULL_SMALL:
+            *glyph_width = font_full_small_widths[idx];
+            *glyph_height = font_full_small_height;
+            break;
+        case FONT_METER_SMALL:
+            *glyph_width = font_meter_small_widths[idx];
+            *glyph_height = font_meter_small_height;
+            break;
+        case FONT_METER_MEDIUM:
+            *glyph_width = font_meter_medium_widths[idx];
+            *glyph_height = font_meter_medium_height;
+            break;
+        case FONT_METER_LARGE:
+            *glyph_width = font_meter_large_widths[idx];
+            *glyph_height = font_meter_large_height;
+            break;
+        default:
+            printf("Error: cannot print at size %d\n", (int) size);
+            *glyph_width = *glyph_height = 0;
+            return;
+    }
+}
+
+/**
+  * @brief Determine glyph pixel data given the supplied character and font size
+  * @param size font size
+  * @param ch the character (must be a supported character)
+  * @param glyph_pixdata (out) the pointer to the pixel data for the glyph
+  * @param glyph_size (out) the number of bytes taken up in pixdata for this glyph
+  * @retval none
+  */
+void tft_get_glyph_pixdata(tft_font_size_t size, char ch, const uint8_t **glyph_pixdata, uint32_t *glyph_size)
+{
+    size_t idx = ch - 0x20;
+    switch(size) {
+        case FONT_FULL_SMALL:
+            *glyph_pixdata = &font_full_small_pixdata[font_full_small_offsets[idx]];
+            *glyph_size = font_full_small_sizes[idx];
+            break;
+        case FONT_METER_SMALL:
+            *glyph_pixdata = &font_meter_small_pixdata[font_meter_small_offsets[idx]];
+            *glyph_size = font_meter_small_sizes[idx];
+            break;
+        case FONT_METER_MEDIUM:
+            *glyph_pixdata = &font_meter_medium_pixdata[font_meter_medium_offsets[idx]];
+            *glyph_size = font_meter_medium_sizes[idx];
+            break;
+        case FONT_METER_LARGE:
+            *glyph_pixdata = &font_meter_large_pixdata[font_meter_large_offsets[idx]];
+            *glyph_size = font_meter_large_sizes[idx];
+            break;
+        default:
+            printf("Error: cannot print at size %d\n", (int) size);
+            *glyph_pixdata = NULL;
+            *glyph_size = 0;
+            return;
+    }
 }
 
 /**
   * @brief Blit character on TFT
-  * @param size size of character (0:small 1:large)
+  * @param size size of character
   * @param ch the character (must be a supported character)
   * @param x x position
   * @param y y position
   * @param w width of bounding box
   * @param h height of bounding box
+  * @param color color of the glyph
   * @param highlight if true, the character will be inverted
-  * @retval none
+  * @retval the width of the character drawn
   */
 uint8_t tft_putch(tft_font_size_t size, char ch, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color, bool invert)
 {
+    uint32_t glyph_width, glyph_height;
+    uint32_t xpos, ypos;
+
     if (x >= TFT_WIDTH || y >= TFT_HEIGHT) {
         printf("Error: character '%c' put outside of screen (%d, %d)\n", ch, x, y);
+        return 0;
     }
     tft[x][y] = ch;
-    (void) size;
-    (void) w;
-    (void) h;
-    (void) color;
-    (void) invert;
+
+    tft_get_glyph_metrics(size, ch, &glyph_width, &glyph_height);
+    if (glyph_width == 0 || glyph_height == 0) {
+        printf("Error: glyph 0x%02X does not exist in font size %d\n", (int) ch, (int) size);
+        return 0;
+    }
+
+    /** Position glyph in center of region */
+    xpos = x+(w-glyph_width)/2;
+    ypos = y+(h-glyph_height)/2;
+
+    PROFILE_START(profile, profile_putch, NULL, PROFILE_NO_ITEM);
+    set_window(xpos, ypos, xpos + glyph_width-1, ypos + glyph_height-1);
+    draw_glyph(size, ch, glyph_width * glyph_height, invert, color);
+
+    /** If our glyph hasn't filled the entire region fill the remainder in with black or white depending on if we're inverting */
+    uint16_t fill_color = invert ? WHITE : BLACK;
+    if (x < xpos) {
+        tft_fill(x, y, xpos-x, h, fill_color);
+    }
+    if (xpos+glyph_width < x+w) {
+        tft_fill(xpos+glyph_width, y, (w-glyph_width+1)/2, h, fill_color);
+    }
+    PROFILE_STOP(profile);
+
+    return glyph_width;
 }
 
 /**
@@ -134,14 +597,53 @@ uint8_t tft_putch(tft_font_size_t size, char ch, uint32_t x, uint32_t y, uint32_
   */
 uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color, bool invert)
 {
-    (void) size;
-    (void) str;
-    (void) x;
-    (void) y;
-    (void) w;
-    (void) h;
-    (void) color;
-    (void) invert;
+    uint32_t width_remainder, screen_remainder, draw_remainder;
+    uint32_t xpos, ypos;
+    uint32_t space_width, font_height;
+    uint8_t spacing = tft_get_glyph_spacing(size);
+    bool first = true;
+
+    tft_get_glyph_metrics(size, ' ', &space_width, &font_height);
+    xpos = x;
+    ypos = y - font_height;
+    PROFILE_START(profile, profile_puts, NULL, PROFILE_NO_ITEM);
+
+    while (str && *str) {
+        uint32_t glyph_width, glyph_height;
+
+        if (!first) {
+            tft_fill(xpos, ypos, spacing, h, invert ? WHITE : BLACK);
+            xpos += spacing;
+        }
+
+        tft_get_glyph_metrics(size, *str, &glyph_width, &glyph_height);
+        if (glyph_width == 0 || glyph_height == 0) {
+            printf("Error: glyph 0x%02X does not exist in font size %d\n", (int) *str, (int) size);
+            ++str;
+            continue;
+        }
+
+        /** Check if this character would exceed the supplied width or screen width, blank the rest and drop out if so */
+        width_remainder = w - (xpos - x);
+        screen_remainder = GRAM_WIDTH - (xpos - x);
+        draw_remainder = width_remainder < screen_remainder ? width_remainder : screen_remainder;
+        if (glyph_width > draw_remainder) {
+            tft_fill(xpos, ypos, draw_remainder, glyph_height, invert ? WHITE : BLACK);
+            xpos += draw_remainder;
+            break;
+        }
+
+        set_window(xpos, ypos, xpos + glyph_width-1, ypos + glyph_height-1);
+        draw_glyph(size, *str, glyph_width * glyph_height, invert, color);
+
+        xpos += glyph_width;
+
+        first = false;
+        ++str;
+    }
+    PROFILE_STOP(profile);
+
+    return xpos - x;
 }
 
 /**
@@ -154,12 +656,47 @@ uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y,
   */
 void tft_fill_pattern(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint8_t *fill, uint32_t fill_size)
 {
-    (void) x1;
-    (void) y1;
-    (void) x2;
-    (void) y2;
-    (void) fill;
-    (void) fill_size;
+    uint32_t count = (x2-x1+1)*(y2-y1+1);
+    set_window(x1, y1, x2, y2);
+    for (uint32_t i = 0; fill_size >= 2 && i < count; i++) {
+        push_bytes(&fill[(2*i) % (fill_size & ~1)], 1);
+    }
+}
+
+/**
+ * @brief Draw a horizontal line clipped like ili9163c_draw_hline
+ * @param x y start position
+ * @param w width
+ * @param color the color
+ * @retval none
+ */
+static void draw_hline(uint32_t x, uint32_t y, uint32_t w, uint16_t color)
+{
+    if (x >= TFT_WIDTH || y >= TFT_HEIGHT) {
+        return;
+    }
+    if (x + w > TFT_WIDTH) {
+        w = TFT_WIDTH - x;
+    }
+    tft_fill(x, y, w, 1, color);
+}
+
+/**
+ * @brief Draw a vertical line clipped like ili9163c_draw_vline
+ * @param x y start position
+ * @param h height
+ * @param color the color
+ * @retval none
+ */
+static void draw_vline(uint32_t x, uint32_t y, uint32_t h, uint16_t color)
+{
+    if (x >= TFT_WIDTH || y >= TFT_HEIGHT) {
+        return;
+    }
+    if (y + h > TFT_HEIGHT) {
+        h = TFT_HEIGHT - y;
+    }
+    tft_fill(x, y, 1, h, color);
 }
 
 /**
@@ -173,11 +710,10 @@ void tft_fill_pattern(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint8_
   */
 void tft_rect(uint32_t xpos, uint32_t ypos, uint32_t width, uint32_t height, uint16_t color)
 {
-    (void) xpos;
-    (void) ypos;
-    (void) width;
-    (void) height;
-    (void) color;
+    draw_hline(xpos, ypos, width, color);
+    draw_hline(xpos, ypos + height, width, color);
+    draw_vline(xpos, ypos, height, color);
+    draw_vline(xpos + width, ypos, height, color);
 }
 
 /**
@@ -190,11 +726,47 @@ void tft_rect(uint32_t xpos, uint32_t ypos, uint32_t width, uint32_t height, uin
   */
 void tft_fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color)
 {
-    (void) x;
-    (void) y;
-    (void) w;
-    (void) h;
-    (void) color;
+    if (!w || !h) {
+        return;
+    }
+    set_window(x, y, x+w-1, y+h-1);
+    push_colors(color, w * h);
+}
+
+/**
+  * @brief Draw a one pixel wide column as runs of colors, top to bottom
+  * @param x x position
+  * @param y y position of the top pixel
+  * @param runs length of each run
+  * @param colors color of each run in bgr565 format
+  * @param num_runs number of runs
+  * @retval none
+  */
+void tft_column(uint32_t x, uint32_t y, const uint8_t *runs, const uint16_t *colors, uint32_t num_runs)
+{
+    uint32_t height = 0;
+    for (uint32_t i = 0; i < num_runs; i++) {
+        height += runs[i];
+    }
+    if (!height) {
+        return;
+    }
+    set_window(x, y, x, y + height-1);
+    for (uint32_t i = 0; i < num_runs; i++) {
+        push_colors(colors[i], runs[i]);
+    }
+}
+
+/**
+  * @brief Scroll the whole display horizontally, with the scroll start sent
+  *        to the display controller by the firmware
+  * @param x the column shown at the left edge of the display
+  * @retval none
+  */
+void tft_scroll(uint32_t x)
+{
+    scroll_lines = TFT_SCROLL_LINES(x, TFT_WIDTH);
+    byte_count += 1 + 2;
 }
 
 /**
@@ -204,7 +776,8 @@ void tft_fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color)
   */
 void tft_invert(bool invert)
 {
-    (void) invert;
+    is_inverted = invert;
+    byte_count += 1;
 }
 
 /**
@@ -213,5 +786,5 @@ void tft_invert(bool invert)
   */
 bool tft_is_inverted(void)
 {
-    return false;
+    return is_inverted;
 }
@@ -32,13 +32,18 @@
 #include "hw.h"
 #include "pwrctl.h"
 #include "serialhandler.h"
-
-extern void opendps_update_power_status(bool enabled); // opendps.c
+#include "tft.h"
+#include "uui.h"
+#include "opendps.h"
 
 static void stat_cmd(uint32_t argc, char *argv[]);
 static void on_cmd(uint32_t argc, char *argv[]);
 static void off_cmd(uint32_t argc, char *argv[]);
 static void v_cmd(uint32_t argc, char *argv[]);
+static void tftbench_cmd(uint32_t argc, char *argv[]);
+#ifdef CONFIG_GLYPH_CACHE
+static void glyphcache_cmd(uint32_t argc, char *argv[]);
+#endif // CONFIG_GLYPH_CACHE
 
 
 static const cli_command_t commands[] = {
@@ -70,6 +75,22 @@ static const cli_command_t commands[] = {
         .help = "Set output <voltage> mV",
         .usage = "<millivolt>",
     },
+    {
+        .cmd = "tftbench",
+        .handler = &tftbench_cmd,
+        .min_arg = 0, .max_arg = 0,
+        .help = "Measure display throughput and string draw time",
+        .usage = "",
+    },
+#ifdef CONFIG_GLYPH_CACHE
+    {
+        .cmd = "glyphcache",
+        .handler = &glyphcache_cmd,
+        .min_arg = 0, .max_arg = 0,
+        .help = "Print glyph cache hits, misses and usage",
+        .usage = "",
+    },
+#endif // CONFIG_GLYPH_CACHE
   };
 
 
@@ -143,3 +164,28 @@ static void v_cmd(uint32_t argc, char *argv[])
     dbg_printf("Setting V_out to %umv\n", v_out);
     pwrctl_set_vout(v_out);
 }
+
+static void tftbench_cmd(uint32_t argc, char *argv[])
+{
+    (void) argc;
+    (void) argv;
+    uint32_t fill_pps, blit_pps, string_cycles;
+    tft_benchmark(&fill_pps, &blit_pps, &string_cycles);
+    dbg_printf(" Fill   : %u pixels/s\n", fill_pps);
+    dbg_printf(" Glyph  : %u pixels/s\n", blit_pps);
+    dbg_printf(" String : %u cycles\n", string_cycles);
+    opendps_redraw();
+}
+
+#ifdef CONFIG_GLYPH_CACHE
+static void glyphcache_cmd(uint32_t argc, char *argv[])
+{
+    (void) argc;
+    (void) argv;
+    uint32_t hits, misses, used;
+    tft_get_glyph_cache_stats(&hits, &misses, &used);
+    dbg_printf(" Hits   : %u\n", hits);
+    dbg_printf(" Misses : %u\n", misses);
+    dbg_printf(" Used   : %u bytes\n", used);
+}
+#endif // CONFIG_GLYPH_CACHE
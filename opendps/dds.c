@@ -0,0 +1,237 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "dds.h"
+
+/** A divider this close to the requested frequency is good enough, more
+    samples per cycle are preferred over a better match */
+#define DDS_GOOD_ENOUGH  (0.0001f)
+
+/*
+ * The number of bits of our data type: here 16 (sizeof operator returns bytes).
+ */
+#define INT16_BITS  (8 * sizeof(int16_t))
+#ifndef INT16_MAX
+#define INT16_MAX   ((1<<(INT16_BITS-1))-1)
+#endif
+
+/*
+ * "5 bit" large table = 32 values. The mask: all bit belonging to the table
+ * are 1, the all above 0.
+ */
+#define TABLE_BITS  (5)
+#define TABLE_SIZE  (1<<TABLE_BITS)
+#define TABLE_MASK  (TABLE_SIZE-1)
+
+/*
+ * The lookup table is to 90DEG, the input can be -360 to 360 DEG, where negative
+ * values are transformed to positive before further processing. We need two
+ * additional bits (*4) to represent 360 DEG:
+ */
+#define LOOKUP_BITS (TABLE_BITS+2)
+#define LOOKUP_MASK ((1<<LOOKUP_BITS)-1)
+#define FLIP_BIT    (1<<TABLE_BITS)
+#define NEGATE_BIT  (1<<(TABLE_BITS+1))
+#define INTERP_BITS (INT16_BITS-1-LOOKUP_BITS)
+#define INTERP_MASK ((1<<INTERP_BITS)-1)
+
+/**
+ * "5 bit" lookup table for the offsets. These are the sines for exactly
+ * at 0deg, 11.25deg, 22.5deg etc. The values are from -1 to 1 in Q15.
+ */
+static const int16_t sin90[TABLE_SIZE+1] = {
+  0x0000,0x0647,0x0c8b,0x12c7,0x18f8,0x1f19,0x2527,0x2b1e,
+  0x30fb,0x36b9,0x3c56,0x41cd,0x471c,0x4c3f,0x5133,0x55f4,
+  0x5a81,0x5ed6,0x62f1,0x66ce,0x6a6c,0x6dc9,0x70e1,0x73b5,
+  0x7640,0x7883,0x7a7c,0x7c29,0x7d89,0x7e9c,0x7f61,0x7fd7,
+  0x7fff
+};
+
+/**
+ * Sine calculation using interpolated table lookup.
+ * Instead of radiants or degrees we use "turns" here. Means this
+ * sine does NOT return one phase for 0 to 2*PI, but for 0 to 1.
+ * Input: -1 to 1 as int16 Q15  == -32768 to 32767.
+ * Output: -1 to 1 as int16 Q15 == -32768 to 32767.
+ *
+ * See the full description at www.AtWillys.de for the detailed
+ * explanation.
+ *
+ * @param int16_t angle Q15
+ * @return int16_t Q15
+ */
+static int16_t sin1(int16_t angle)
+{
+  int16_t v0, v1;
+  if(angle < 0) { angle += INT16_MAX; angle += 1; }
+  v0 = (angle >> INTERP_BITS);
+  if(v0 & FLIP_BIT) { v0 = ~v0; v1 = ~angle; } else { v1 = angle; }
+  v0 &= TABLE_MASK;
+  v1 = sin90[v0] + (int16_t) (((int32_t) (sin90[v0+1]-sin90[v0]) * (v1 & INTERP_MASK)) >> INTERP_BITS);
+  if((angle >> INTERP_BITS) & NEGATE_BIT) v1 = -v1;
+  return v1;
+}
+
+/**
+  * @brief Find the number of cycles in the buffer and the timer divider that
+  *        give the frequency closest to the requested one
+  * @param freq_dhz frequency in dHz, 1 to DDS_MAX_FREQUENCY
+  * @param plan (out) the buffer and timer settings
+  * @retval false if the frequency is out of range
+  */
+bool dds_plan(uint32_t freq_dhz, dds_plan_t *plan)
+{
+    if (freq_dhz == 0 || freq_dhz > DDS_MAX_FREQUENCY) {
+        return false;
+    }
+    float best_error = 1.0f;
+    for (uint32_t cycles = 1; cycles <= DDS_BUFFER_SIZE / DDS_MIN_CYCLE_SAMPLES; cycles++) {
+        /** The timer divides the clock down to the sample rate, which is
+            freq * DDS_BUFFER_SIZE / cycles */
+        uint64_t num = (uint64_t) DDS_TIMER_CLOCK * 10 * cycles;
+        uint64_t den = (uint64_t) freq_dhz * DDS_BUFFER_SIZE;
+        uint32_t divider = (num + den / 2) / den;
+        if (divider < DDS_TIMER_CLOCK / DDS_MAX_SAMPLE_RATE) {
+            continue; /** Sampling too fast, more cycles slow it down */
+        }
+        uint32_t prescaler = (divider + 0xffff) >> 16;
+        uint32_t period = (divider + prescaler / 2) / prescaler;
+        float error = (float) prescaler * period * den / num - 1.0f;
+        if (error < 0) {
+            error = -error;
+        }
+        if (error < best_error) {
+            best_error = error;
+            plan->cycles = cycles;
+            plan->prescaler = prescaler - 1;
+            plan->period = period - 1;
+        }
+        if (best_error <= DDS_GOOD_ENOUGH) {
+            break;
+        }
+    }
+    return best_error < 1.0f;
+}
+
+/**
+  * @brief Fill a buffer with a waveform
+  * @param buffer DDS_BUFFER_SIZE samples
+  * @param wave the waveform
+  * @param max_mv the top of the waveform, the bottom is 0V
+  * @param cycles waveform cycles in the buffer
+  * @retval none
+  */
+void dds_fill(uint16_t *buffer, dds_wave_t wave, uint32_t max_mv, uint32_t cycles)
+{
+    /** The phase wraps exactly once per cycle */
+    uint32_t phase = 0;
+    uint32_t step = cycles << (32 - DDS_BUFFER_BITS);
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        switch (wave) {
+            case dds_square:
+                buffer[i] = phase < 0x80000000 ? max_mv : 0;
+                break;
+            case dds_saw:
+                buffer[i] = ((uint64_t) max_mv * phase) >> 32;
+                break;
+            case dds_sine:
+                /** There's a small error in amplitude here to avoid dividing by 32767 */
+                buffer[i] = (int32_t) (max_mv / 2) * sin1(phase >> 17) / 32768 + max_mv / 2;
+                break;
+        }
+        phase += step;
+    }
+}
+
+/**
+  * @brief Fill a buffer with an arbitrary waveform, one cycle being a table
+  *        of points linearly interpolated to the samples of the cycle
+  * @param buffer DDS_BUFFER_SIZE samples
+  * @param table the points of one cycle in mV
+  * @param num_points number of points in the table, 1 to DDS_BUFFER_SIZE
+  * @param max_mv points above this voltage are clipped
+  * @param cycles waveform cycles in the buffer
+  * @retval none
+  */
+void dds_fill_table(uint16_t *buffer, const uint16_t *table, uint32_t num_points, uint32_t max_mv, uint32_t cycles)
+{
+    uint32_t phase = 0;
+    uint32_t step = cycles << (32 - DDS_BUFFER_BITS);
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        /** The integer part of phase * num_points is the point, the fraction
+            the distance to the next one */
+        uint64_t position = (uint64_t) phase * num_points;
+        uint32_t index = position >> 32;
+        uint32_t fraction = (uint32_t) position >> 16;
+        int32_t from = table[index];
+        int32_t to = table[index + 1 < num_points ? index + 1 : 0];
+        uint32_t mv = from + (int32_t) (((int64_t) (to - from) * fraction) >> 16);
+        buffer[i] = mv < max_mv ? mv : max_mv;
+        phase += step;
+    }
+}
+
+/**
+  * @brief Write a chunk of a table upload. The chunks must be written in order
+  *        starting at offset 0, a chunk at offset 0 starts a new upload
+  * @param upload the upload
+  * @param num_points number of points in the table, 1 to DDS_BUFFER_SIZE
+  * @param offset index of the first point in the chunk
+  * @param points the points in mV
+  * @param count number of points in the chunk
+  * @retval false if the chunk is out of order or out of range, the upload
+  *         is left as it was
+  */
+bool dds_upload_write(dds_upload_t *upload, uint32_t num_points, uint32_t offset, const uint16_t *points, uint32_t count)
+{
+    if (num_points == 0 || num_points > DDS_BUFFER_SIZE || offset + count > num_points) {
+        return false;
+    }
+    if (offset != 0 && (offset != upload->next || num_points != upload->num_points)) {
+        /** A lost or repeated chunk would mix points of two tables */
+        return false;
+    }
+    upload->num_points = num_points;
+    memcpy(&upload->mv[offset], points, count * sizeof(uint16_t));
+    upload->next = offset + count;
+    return true;
+}
+
+/**
+  * @brief Check if the last chunk of an upload has been written, the upload
+  *        is then finished and the next chunk must be at offset 0
+  * @param upload the upload
+  * @retval true if the whole table has arrived
+  */
+bool dds_upload_complete(dds_upload_t *upload)
+{
+    if (upload->next == 0 || upload->next != upload->num_points) {
+        return false;
+    }
+    upload->next = 0;
+    return true;
+}
@@ -0,0 +1,127 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __DDS_H__
+#define __DDS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Direct digital synthesis for the function generator. A 32 bit phase
+ * accumulator steps through the selected waveform, writing a buffer that
+ * holds a whole number of cycles. The buffer is fed to the voltage DAC by a
+ * timer triggered circular DMA, so once started the output runs without any
+ * CPU involvement. The frequency is set by the number of cycles in the buffer
+ * and the timer divider, see dds_plan().
+ */
+
+/** Samples in the DMA buffer, a power of two so whole cycles wrap the phase
+    accumulator exactly */
+#define DDS_BUFFER_BITS  (8)
+#define DDS_BUFFER_SIZE  (1 << DDS_BUFFER_BITS)
+
+/** Clock of the timer pacing the samples (Hz) */
+#define DDS_TIMER_CLOCK  (48000000)
+/** Highest sample rate, bounds the DMA load (Hz) */
+#define DDS_MAX_SAMPLE_RATE  (100000)
+/** Fewest samples in one waveform cycle */
+#define DDS_MIN_CYCLE_SAMPLES  (16)
+/** Highest frequency (dHz), below DDS_MAX_SAMPLE_RATE / DDS_MIN_CYCLE_SAMPLES
+    to leave a choice of dividers for an accurate frequency */
+#define DDS_MAX_FREQUENCY  (50000)
+
+typedef enum {
+    dds_square = 0,
+    dds_saw,
+    dds_sine,
+} dds_wave_t;
+
+typedef struct {
+    uint32_t cycles; /** Waveform cycles in the buffer */
+    uint32_t prescaler; /** Timer prescaler - 1 */
+    uint32_t period; /** Timer period - 1 */
+} dds_plan_t;
+
+/** An arbitrary waveform table being uploaded in chunks, kept apart from the
+    table being played until the whole table has arrived */
+typedef struct {
+    uint32_t num_points; /** Points in the table being uploaded */
+    uint32_t next; /** Index of the point expected next, 0 when no upload is in progress */
+    uint16_t mv[DDS_BUFFER_SIZE];
+} dds_upload_t;
+
+/**
+  * @brief Find the number of cycles in the buffer and the timer divider that
+  *        give the frequency closest to the requested one
+  * @param freq_dhz frequency in dHz, 1 to DDS_MAX_FREQUENCY
+  * @param plan (out) the buffer and timer settings
+  * @retval false if the frequency is out of range
+  */
+bool dds_plan(uint32_t freq_dhz, dds_plan_t *plan);
+
+/**
+  * @brief Fill a buffer with a waveform
+  * @param buffer DDS_BUFFER_SIZE samples
+  * @param wave the waveform
+  * @param max_mv the top of the waveform, the bottom is 0V
+  * @param cycles waveform cycles in the buffer
+  * @retval none
+  */
+void dds_fill(uint16_t *buffer, dds_wave_t wave, uint32_t max_mv, uint32_t cycles);
+
+/**
+  * @brief Fill a buffer with an arbitrary waveform, one cycle being a table
+  *        of points linearly interpolated to the samples of the cycle
+  * @param buffer DDS_BUFFER_SIZE samples
+  * @param table the points of one cycle in mV
+  * @param num_points number of points in the table, 1 to DDS_BUFFER_SIZE
+  * @param max_mv points above this voltage are clipped
+  * @param cycles waveform cycles in the buffer
+  * @retval none
+  */
+void dds_fill_table(uint16_t *buffer, const uint16_t *table, uint32_t num_points, uint32_t max_mv, uint32_t cycles);
+
+/**
+  * @brief Write a chunk of a table upload. The chunks must be written in order
+  *        starting at offset 0, a chunk at offset 0 starts a new upload
+  * @param upload the upload
+  * @param num_points number of points in the table, 1 to DDS_BUFFER_SIZE
+  * @param offset index of the first point in the chunk
+  * @param points the points in mV
+  * @param count number of points in the chunk
+  * @retval false if the chunk is out of order or out of range, the upload
+  *         is left as it was
+  */
+bool dds_upload_write(dds_upload_t *upload, uint32_t num_points, uint32_t offset, const uint16_t *points, uint32_t count);
+
+/**
+  * @brief Check if the last chunk of an upload has been written, the upload
+  *        is then finished and the next chunk must be at offset 0
+  * @param upload the upload
+  * @retval true if the whole table has arrived
+  */
+bool dds_upload_complete(dds_upload_t *upload);
+
+#endif // __DDS_H__
@@ -26,54 +26,112 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef DPS_EMULATOR
+#include <cortex.h>
+#endif // DPS_EMULATOR
 #include "ringbuf.h"
 #include "event.h"
 
-#define MAX_EVENTS	(64)
+/** Protection events, buttons and measurements are queued apart from the
+    UART bytes and frames so a burst of serial traffic cannot crowd them out */
+#define MAX_HIGH_EVENTS	(16)
+#define MAX_BULK_EVENTS	(64)
 
-static ringbuf_t events;
-static uint8_t buffer[2*MAX_EVENTS];
+static ringbuf_t queues[event_class_max];
+static uint8_t high_buffer[2*MAX_HIGH_EVENTS];
+static uint8_t bulk_buffer[2*MAX_BULK_EVENTS];
+static uint32_t overflows[event_class_max];
 
 
+/**
+  * @brief Get the queue class of an event
+  * @param event the event
+  * @retval the class
+  */
+static event_class_t event_class(event_t event)
+{
+	return event == event_uart_rx || event == event_frame_ready ? event_class_bulk : event_class_high;
+}
+
 /**
   * @brief Initialize the event module
   * @retval None
   */
 void event_init(void)
 {
-	ringbuf_init(&events, (uint8_t*) buffer, sizeof(buffer));
-	memset(buffer, 0, sizeof(buffer));
+	ringbuf_init(&queues[event_class_high], (uint8_t*) high_buffer, sizeof(high_buffer));
+	ringbuf_init(&queues[event_class_bulk], (uint8_t*) bulk_buffer, sizeof(bulk_buffer));
+	memset(high_buffer, 0, sizeof(high_buffer));
+	memset(bulk_buffer, 0, sizeof(bulk_buffer));
+	memset(overflows, 0, sizeof(overflows));
 }
 
 /**
-  * @brief Fetch next event in queue
+  * @brief Fetch next event in queue, high priority events are returned first
   * @param event the type of event received or 'event_none' if no events in queue
   * @param data additional event data
   * @retval true if an event was found
   */
 bool event_get(event_t *event, uint8_t *data)
 {
-	bool got_event = true;
 	uint16_t e;
-	if (!ringbuf_get(&events, &e)) {
-		*event = event_none;
-		*data = 0;
-		got_event = false;
-	} else {
-		*event = e >> 8;
-		*data = e & 0xff;
-
+	for (uint32_t i = 0; i < event_class_max; i++) {
+		if (ringbuf_get(&queues[i], &e)) {
+			*event = e >> 8;
+			*data = e & 0xff;
+			return true;
+		}
 	}
-	return got_event;
+	*event = event_none;
+	*data = 0;
+	return false;
 }
 
 /**
-  * @brief Place event in event fifo
+  * @brief Place event in the event fifo of its class
   * @param event event type
   * @param data additional event data
-  * @retval None
+  * @retval true if there was room for the event, else the overflow counter
+  *         of its class is incremented
   */
 bool event_put(event_t event, uint8_t data)
 {
-	return ringbuf_put(&events, (uint16_t) (event << 8 | data));
+	event_class_t class = event_class(event);
+	/** The fifos take one producer, but events are put from several ISRs and
+	    the main loop that may preempt each other */
+#ifndef DPS_EMULATOR
+	uint32_t masked = cm_mask_interrupts(1);
+#endif // DPS_EMULATOR
+	bool success = ringbuf_put(&queues[class], (uint16_t) (event << 8 | data));
+	if (!success) {
+		overflows[class]++;
+	}
+#ifndef DPS_EMULATOR
+	cm_mask_interrupts(masked);
+#endif // DPS_EMULATOR
+	return success;
+}
+
+/**
+  * @brief Check if there are events in the queue
+  * @retval true if event_get(...) would return an event
+  */
+bool event_pending(void)
+{
+	for (uint32_t i = 0; i < event_class_max; i++) {
+		if (!ringbuf_empty(&queues[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+  * @brief Get the number of events dropped because their fifo was full
+  * @param class the event class
+  * @retval number of dropped events since start up
+  */
+uint32_t event_overflows(event_class_t class)
+{
+	return class < event_class_max ? overflows[class] : 0;
 }
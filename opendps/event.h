@@ -39,9 +39,18 @@ typedef enum {
 	event_rot_press,
 	event_uart_rx,
 	event_ocp,
-	event_ovp
+	event_ovp,
+	event_measurement, /** New averaged ADC values, see hw_ack_measurement */
+	event_frame_ready /** A frame was received, the data is its rxframe buffer index */
 } event_t;
 
+/** Each class has its own fifo, the classes are drained in this order */
+typedef enum {
+	event_class_high = 0, /** Protection, buttons and measurements */
+	event_class_bulk, /** UART bytes and frames */
+	event_class_max
+} event_class_t;
+
 typedef enum {
 	press_short = 0,
 	press_long,
@@ -55,7 +64,7 @@ typedef enum {
 void event_init(void);
 
 /**
-  * @brief Fetch next event in queue
+  * @brief Fetch next event in queue, high priority events are returned first
   * @param event the type of event received or 'event_none' if no events in queue
   * @param data additional event data
   * @retval true if an event was found
@@ -63,11 +72,25 @@ void event_init(void);
 bool event_get(event_t *event, uint8_t *data);
 
 /**
-  * @brief Place event in event fifo
+  * @brief Place event in the event fifo of its class
   * @param event event type
   * @param data additional event data
-  * @retval None
+  * @retval true if there was room for the event, else the overflow counter
+  *         of its class is incremented
   */
 bool event_put(event_t event, uint8_t data);
 
+/**
+  * @brief Check if there are events in the queue
+  * @retval true if event_get(...) would return an event
+  */
+bool event_pending(void);
+
+/**
+  * @brief Get the number of events dropped because their fifo was full
+  * @param class the event class
+  * @retval number of dropped events since start up
+  */
+uint32_t event_overflows(event_class_t class);
+
 #endif // __EVENT_H__
@@ -114,7 +114,7 @@ ui_number_t cc_current = {
 ui_screen_t cc_screen = {
     .id = SCREEN_ID,
     .name = "cc",
-    .icon_data = (uint8_t *) gfx_cc,
+    .icon_data = gfx_cc,
     .icon_data_len = sizeof(gfx_cc),
     .icon_width = GFX_CC_WIDTH,
     .icon_height = GFX_CC_HEIGHT,
@@ -309,11 +309,7 @@ static void cc_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            int32_t new_u = pwrctl_calc_vout(v_out_raw);
-            if (new_u != cc_voltage.value) {
-                cc_voltage.value = new_u;
-                cc_voltage.ui.draw(&cc_voltage.ui);
-            }
+            (void) number_update(&cc_voltage, pwrctl_calc_vout(v_out_raw));
         }
 
         if (cc_current.ui.has_focus) {
@@ -325,11 +321,7 @@ static void cc_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            int32_t new_i = pwrctl_calc_iout(i_out_raw);
-            if (new_i != cc_current.value) {
-                cc_current.value = new_i;
-                cc_current.ui.draw(&cc_current.ui);
-            }
+            (void) number_update(&cc_current, pwrctl_calc_iout(i_out_raw));
         }
     }
 }
@@ -122,7 +122,7 @@ ui_number_t cl_current = {
 ui_screen_t cl_screen = {
     .id = SCREEN_ID,
     .name = "cl",
-    .icon_data = (uint8_t *) gfx_cl,
+    .icon_data = gfx_cl,
     .icon_data_len = sizeof(gfx_cl),
     .icon_width = GFX_CL_WIDTH,
     .icon_height = GFX_CL_HEIGHT,
@@ -344,10 +344,7 @@ static void cl_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            if (cl_voltage.value != vout_actual) {
-                cl_voltage.value = vout_actual;
-                cl_voltage.ui.draw(&cl_voltage.ui);
-            }
+            (void) number_update(&cl_voltage, vout_actual);
         }
 
         if (cl_current.ui.has_focus) {
@@ -359,10 +356,7 @@ static void cl_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            if (cl_current.value != cout_actual) {
-                cl_current.value = cout_actual;
-                cl_current.ui.draw(&cl_current.ui);
-            }
+            (void) number_update(&cl_current, cout_actual);
         }
 
         /** Determine if we are in CV or CC mode and display it */
@@ -371,12 +365,12 @@ static void cl_tick(void)
 
         if (cout_diff < vout_diff) {
             if (current_mode_gfx != CUR_GFX_CC) {
-                tft_blit((uint16_t*) gfx_cc, GFX_CC_WIDTH, GFX_CC_HEIGHT, XPOS_CCCV, 128 - GFX_CC_HEIGHT);
+                tft_blit_rle(gfx_cc, GFX_CC_WIDTH, GFX_CC_HEIGHT, XPOS_CCCV, 128 - GFX_CC_HEIGHT);
                 current_mode_gfx = CUR_GFX_CC;
             }
         } else {
             if (current_mode_gfx != CUR_GFX_CV) {
-                tft_blit((uint16_t*) gfx_cv, GFX_CV_WIDTH, GFX_CV_HEIGHT, XPOS_CCCV, 128 - GFX_CV_HEIGHT);
+                tft_blit_rle(gfx_cv, GFX_CV_WIDTH, GFX_CV_HEIGHT, XPOS_CCCV, 128 - GFX_CV_HEIGHT);
                 current_mode_gfx = CUR_GFX_CV;
             }
         }
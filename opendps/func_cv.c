@@ -112,7 +112,7 @@ ui_number_t cv_current = {
 ui_screen_t cv_screen = {
     .id = SCREEN_ID,
     .name = "cv",
-    .icon_data = (uint8_t *) gfx_cv,
+    .icon_data = gfx_cv,
     .icon_data_len = sizeof(gfx_cv),
     .icon_width = GFX_CV_WIDTH,
     .icon_height = GFX_CV_HEIGHT,
@@ -308,11 +308,7 @@ static void cv_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            int32_t new_u = pwrctl_calc_vout(v_out_raw);
-            if (new_u != cv_voltage.value) {
-                cv_voltage.value = new_u;
-                cv_voltage.ui.draw(&cv_voltage.ui);
-            }
+            (void) number_update(&cv_voltage, pwrctl_calc_vout(v_out_raw));
         }
 
         if (cv_current.ui.has_focus) {
@@ -324,11 +320,7 @@ static void cv_tick(void)
             }
         } else {
             /** No focus, update display if necessary */
-            int32_t new_i = pwrctl_calc_iout(i_out_raw);
-            if (new_i != cv_current.value) {
-                cv_current.value = new_i;
-                cv_current.ui.draw(&cv_current.ui);
-            }
+            (void) number_update(&cv_current, pwrctl_calc_iout(i_out_raw));
         }
     }
 }
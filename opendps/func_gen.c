@@ -26,11 +26,13 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "gfx-arb.h"
 #include "gfx-sin.h"
 #include "gfx-saw.h"
 #include "gfx-square.h"
 #include "hw.h"
 #include "func_gen.h"
+#include "dds.h"
 #include "uui.h"
 #include "uui_number.h"
 #include "uui_icon.h"
@@ -40,33 +42,18 @@
 #include "ili9163c.h"
 #include "font-full_small.h"
 
-/* We are reacting on the ADC's IRQ which runs at ~20kHz.
- * As such we want at least 20 points per period so the shape of the function is 
- * "clean", so we limit generation to 1kHz. 
- */
-#define MAX_FREQUENCY   999
-
-/* The basic generator function that's selected at runtime */
-typedef int32_t (*compute_func_t)(uint32_t time_in_us, uint32_t period_in_us, int32_t max);
-
 /*
  * This is the implementation of the function generator screen. It has three editable values,
- * voltage, frequency and function type. */
-static void    func_gen(void);
-static int16_t sin1(int16_t angle);
-static int32_t square_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max);
-static int32_t saw_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max);
-static int32_t sin_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max);
-
-/* The basic generator function that's selected at runtime */
-static compute_func_t compute_func = &square_gen;
-
+ * voltage, frequency and function type. The waveform is generated by the DDS module
+ * and fed to the DAC by DMA, see dds.h. The last function plays an arbitrary
+ * waveform uploaded over the serial port, the voltage setting then clips it.
+ */
 static void funcgen_enable(bool _enable);
 static void voltage_changed(ui_number_t *item);
 static void frequency_changed(ui_number_t *item);
 static void func_changed(ui_icon_t *item);
 static void func_gen_tick(void);
-static void compute_period_from_freq(int32_t freq);
+static void update_output(void);
 static void activated(void);
 static void deactivated(void);
 static void past_save(past_t *past);
@@ -74,13 +61,29 @@ static void past_restore(past_t *past);
 static set_param_status_t set_parameter(char *name, char *value);
 static set_param_status_t get_parameter(char *name, char *value, uint32_t value_len);
 
-/* We need to keep copies of the period to avoid recomputing it every time. */
-static uint32_t period_us;
+/* The samples fed to the DAC, in DAC units */
+static uint16_t dds_buffer[DDS_BUFFER_SIZE];
+
+/* The arbitrary waveform, also the layout of its past unit */
+static struct {
+    uint32_t num_points; /** 0 until a waveform has been uploaded */
+    uint16_t mv[FUNC_GEN_MAX_POINTS];
+} waveform;
+
+/* The waveform being uploaded, it replaces the played one once complete */
+static dds_upload_t upload;
+
+/* Where the arbitrary waveform is persisted */
+static past_t *waveform_past;
 
 #define SCREEN_ID  (5)
 #define PAST_U     (0)
 #define PAST_P     (1)
 #define PAST_F     (2)
+#define PAST_W     (3)
+
+/** Index of the arbitrary waveform in the function item, after the dds_wave_t waves */
+#define FUNC_ARBITRARY  (3)
 
 /* This is the definition of the voltage item in the UI */
 ui_number_t gen_voltage = {
@@ -120,9 +123,9 @@ ui_number_t gen_freq = {
     .color = COLOR_AMPERAGE,
     .value = 0,
     .min = 0,
-    .max = MAX_FREQUENCY * 10, /* In dHz */
+    .max = DDS_MAX_FREQUENCY, /* In dHz */
     .si_prefix = si_deci,
-    .num_digits = 3,
+    .num_digits = 4,
     .num_decimals = 1,
     .unit = unit_hertz,
     .changed = &frequency_changed,
@@ -141,16 +144,16 @@ ui_icon_t gen_func = {
     .icons_width = GFX_SQUARE_WIDTH,
     .icons_height = GFX_SQUARE_HEIGHT,
     .value = 0,
-    .num_icons = 3,
+    .num_icons = 4,
     .changed = &func_changed,
-    .icons = { gfx_square, gfx_saw, gfx_sin}
+    .icons = { gfx_square, gfx_saw, gfx_sin, gfx_arb }
 };
 
 /* This is the screen definition */
 ui_screen_t gen_screen = {
     .id = SCREEN_ID,
     .name = "funcgen",
-    .icon_data = (uint8_t *) gfx_sin,
+    .icon_data = gfx_sin,
     .icon_data_len = sizeof(gfx_sin),
     .icon_width = GFX_SIN_WIDTH,
     .icon_height = GFX_SIN_HEIGHT,
@@ -186,142 +189,6 @@ ui_screen_t gen_screen = {
     .items = { (ui_item_t*) &gen_voltage, (ui_item_t*) &gen_freq, (ui_item_t*) &gen_func }
 };
 
-/**
- * @brief      Compute a square signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
- */
-static int32_t square_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
-{
-    if (!period_in_us) return max;
-    /** The time is ticking at 1000000Hz so a unit is 1us. The production is 1 for t in [(t%T) ; (t%T+T/2)], 0 otherwise */
-    uint32_t t = time_in_us % period_in_us;
-    return t <= period_in_us / 2 ? max : 0;
-}
-
-/**
- * @brief      Compute a saw signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
- */
-static int32_t saw_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
-{
-    if (!period_in_us) return max;
-    /* The time is ticking at 1000000Hz so a unit is 1us. The production is (max*(t%T))/T */
-    uint64_t t = time_in_us % period_in_us;
-    /* Here, because the longest period is 10s and max is in millivolt, we can overflow an uint32_t
-       Since CortexM3 has a hw 64 bits multiply and divider, it shouldn't cost more to use it */
-    return (int32_t)((t * max) / period_in_us);
-}
-
-/*
- * The number of bits of our data type: here 16 (sizeof operator returns bytes).
- */
-#define INT16_BITS  (8 * sizeof(int16_t))
-#ifndef INT16_MAX
-#define INT16_MAX   ((1<<(INT16_BITS-1))-1)
-#endif
- 
-/*
- * "5 bit" large table = 32 values. The mask: all bit belonging to the table
- * are 1, the all above 0.
- */
-#define TABLE_BITS  (5)
-#define TABLE_SIZE  (1<<TABLE_BITS)
-#define TABLE_MASK  (TABLE_SIZE-1)
- 
-/*
- * The lookup table is to 90DEG, the input can be -360 to 360 DEG, where negative
- * values are transformed to positive before further processing. We need two
- * additional bits (*4) to represent 360 DEG:
- */
-#define LOOKUP_BITS (TABLE_BITS+2)
-#define LOOKUP_MASK ((1<<LOOKUP_BITS)-1)
-#define FLIP_BIT    (1<<TABLE_BITS)
-#define NEGATE_BIT  (1<<(TABLE_BITS+1))
-#define INTERP_BITS (INT16_BITS-1-LOOKUP_BITS)
-#define INTERP_MASK ((1<<INTERP_BITS)-1)
- 
-/**
- * "5 bit" lookup table for the offsets. These are the sines for exactly
- * at 0deg, 11.25deg, 22.5deg etc. The values are from -1 to 1 in Q15.
- */
-static int16_t sin90[TABLE_SIZE+1] = {
-  0x0000,0x0647,0x0c8b,0x12c7,0x18f8,0x1f19,0x2527,0x2b1e,
-  0x30fb,0x36b9,0x3c56,0x41cd,0x471c,0x4c3f,0x5133,0x55f4,
-  0x5a81,0x5ed6,0x62f1,0x66ce,0x6a6c,0x6dc9,0x70e1,0x73b5,
-  0x7640,0x7883,0x7a7c,0x7c29,0x7d89,0x7e9c,0x7f61,0x7fd7,
-  0x7fff
-};
- 
-/**
- * Sine calculation using interpolated table lookup.
- * Instead of radiants or degrees we use "turns" here. Means this
- * sine does NOT return one phase for 0 to 2*PI, but for 0 to 1.
- * Input: -1 to 1 as int16 Q15  == -32768 to 32767.
- * Output: -1 to 1 as int16 Q15 == -32768 to 32767.
- *
- * See the full description at www.AtWillys.de for the detailed
- * explanation.
- *
- * @param int16_t angle Q15
- * @return int16_t Q15
- */
-static int16_t sin1(int16_t angle)
-{
-  int16_t v0, v1;
-  if(angle < 0) { angle += INT16_MAX; angle += 1; }
-  v0 = (angle >> INTERP_BITS);
-  if(v0 & FLIP_BIT) { v0 = ~v0; v1 = ~angle; } else { v1 = angle; }
-  v0 &= TABLE_MASK;
-  v1 = sin90[v0] + (int16_t) (((int32_t) (sin90[v0+1]-sin90[v0]) * (v1 & INTERP_MASK)) >> INTERP_BITS);
-  if((angle >> INTERP_BITS) & NEGATE_BIT) v1 = -v1;
-  return v1;
-}
-
-
-/**
- * @brief      Compute a sin signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
- */
-static int32_t sin_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
-{
-    if (!period_in_us) return max;
-    /** The time is ticking at 1000000Hz so a unit is 1us. The production is (max/2) * sin((t%T)/T*2*PI) + (max/2) */
-    uint64_t t = time_in_us % period_in_us;
-    
-    /* Here, because the longest period is 10s and max is in millivolt, we can overflow an uint32_t
-       Since CortexM3 has a hw 64 bits multiply and divider, it shouldn't cost more to use it.
-       There's a small error in amplitude here to avoid dividing by 32767 */
-    return (max/2) * sin1((int16_t)((t * 32768) / period_in_us)) / 32768 + max/2; 
-}
-
-/**
- * @brief     Get the new output to apply to the DAC.
- *            This is called in a ISR context, so we have to be as fast as possible here.
- */ 
-static void func_gen(void)
-{
-    /* period_us is updated atomically (it's a word) in the UI's event code and so is max value */
-    int32_t v = (*compute_func)(cur_time_us(), period_us, gen_voltage.value);
-    (void) pwrctl_set_vout(v);
-//    pwrctl_enable_vout(v > 0);
-}
-
-
 /**
  * @brief      Set function parameter
  *
@@ -390,13 +257,36 @@ static set_param_status_t get_parameter(char *name, char *value, uint32_t value_
 }
 
 /**
- * @brief       Compute the period in microsecond from the given frequency 
- * @param[in]   freq    Frequency in dHz
+ * @brief      Regenerate the output after a setting changed. Nothing is
+ *             computed per sample, the buffer is converted to DAC values here
+ *             and the DMA feeds it to the DAC as is.
  */
-static void compute_period_from_freq(int32_t freq)
+static void update_output(void)
 {
-    /* Compute the period to use in microseconds, that's 1e6/freq (and since the frequency is in dHz, needs Hz here) */
-    period_us = (uint32_t)(1000000.0 / (freq * 0.1) + .5);
+    dds_plan_t plan;
+    if (!gen_screen.is_enabled) {
+        return;
+    }
+    hw_dds_stop();
+    if (!dds_plan(gen_freq.value, &plan)) {
+        /** 0Hz, a steady voltage */
+        (void) pwrctl_set_vout(gen_voltage.value);
+        return;
+    }
+    if (gen_func.value == FUNC_ARBITRARY) {
+        if (!waveform.num_points) {
+            /** Nothing uploaded yet */
+            (void) pwrctl_set_vout(0);
+            return;
+        }
+        dds_fill_table(dds_buffer, waveform.mv, waveform.num_points, gen_voltage.value, plan.cycles);
+    } else {
+        dds_fill(dds_buffer, (dds_wave_t) gen_func.value, gen_voltage.value, plan.cycles);
+    }
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        dds_buffer[i] = pwrctl_calc_vout_dac(dds_buffer[i]);
+    }
+    hw_dds_start(dds_buffer, DDS_BUFFER_SIZE, plan.prescaler, plan.period);
 }
 
 /**
@@ -408,18 +298,16 @@ static void funcgen_enable(bool enabled)
 {
     emu_printf("[FNCGEN] %s output\n", enabled ? "Enable" : "Disable");
     if (enabled) {
-        compute_period_from_freq(gen_freq.value);
-        func_changed(&gen_func);
         /* Draw the current function to the expected position */
-        tft_blit((uint16_t*) gen_func.icons[gen_func.value], gen_func.icons_width, gen_func.icons_height, XPOS_ICON, 128 - GFX_SIN_HEIGHT);
+        tft_blit_rle(gen_func.icons[gen_func.value], gen_func.icons_width, gen_func.icons_height, XPOS_ICON, 128 - GFX_SIN_HEIGHT);
         (void) pwrctl_set_vout(gen_voltage.value);
         (void) pwrctl_set_iout(CONFIG_DPS_MAX_CURRENT);
         (void) pwrctl_set_vlimit(0xFFFF);
         (void) pwrctl_set_ilimit(0xFFFF); /** Set the current limit to the maximum to prevent OCP (over current protection) firing */
         pwrctl_enable_vout(true);
-        funcgen_tick = &func_gen;
+        update_output();
     } else {
-        funcgen_tick = &fg_noop;
+        hw_dds_stop();
         (void) pwrctl_set_vout(0);
         pwrctl_enable_vout(false);
         /** Ensure the function logo has been cleared from the screen */
@@ -435,6 +323,7 @@ static void funcgen_enable(bool enabled)
 static void voltage_changed(ui_number_t * item)
 {
     (void)item;
+    update_output();
 }
 
 /**
@@ -444,7 +333,8 @@ static void voltage_changed(ui_number_t * item)
  */
 static void frequency_changed(ui_number_t *item)
 {
-    compute_period_from_freq(item->value);
+    (void)item;
+    update_output();
 }
 
 /**
@@ -454,8 +344,8 @@ static void frequency_changed(ui_number_t *item)
  */
 static void func_changed(ui_icon_t *item)
 {
-    static compute_func_t funcs[] = { &square_gen, &saw_gen, &sin_gen, 0 };
-    compute_func = funcs[item->value];
+    (void)item;
+    update_output();
 }
 
 /**
@@ -514,6 +404,7 @@ static void past_restore(past_t *past)
 {
     uint32_t length;
     uint32_t *p = 0;
+    waveform_past = past;
     if (past_read_unit(past, (SCREEN_ID << 24) | PAST_U, (const void**) &p, &length)) {
         gen_voltage.value = *p;
         (void) length;
@@ -526,6 +417,61 @@ static void past_restore(past_t *past)
         gen_func.value = *p;
         (void) length;
     }
+    if (past_read_unit(past, (SCREEN_ID << 24) | PAST_W, (const void**) &p, &length)) {
+        /** The number of points comes first, followed by the points */
+        if (*p <= FUNC_GEN_PERSIST_POINTS && length >= sizeof(uint32_t) + *p * sizeof(uint16_t)) {
+            memcpy(&waveform, p, sizeof(uint32_t) + *p * sizeof(uint16_t));
+        }
+    }
+}
+
+/**
+ * @brief      Write a chunk of the arbitrary waveform. The chunks must be
+ *             written in order starting at offset 0 and the waveform replaces
+ *             the current one when the chunk reaching its end is written
+ *
+ * @param[in]  num_points  number of points in the waveform, 2 to FUNC_GEN_MAX_POINTS
+ * @param[in]  offset      index of the first point in the chunk
+ * @param[in]  points      the points in mV
+ * @param[in]  count       number of points in the chunk
+ * @param[in]  persist     store the waveform in flash when it is complete,
+ *                         at most FUNC_GEN_PERSIST_POINTS points
+ *
+ * @retval     false if the chunk is out of order or out of range, the
+ *             waveform is too long to be stored or the flash write failed
+ */
+bool func_gen_write_waveform(uint32_t num_points, uint32_t offset, const uint16_t *points, uint32_t count, bool persist)
+{
+    if (num_points < 2 || num_points > FUNC_GEN_MAX_POINTS || offset + count > num_points) {
+        return false;
+    }
+    if (persist && num_points > FUNC_GEN_PERSIST_POINTS) {
+        /** Would crowd the calibration out of past, refuse before the
+            current waveform is touched */
+        return false;
+    }
+    if (!dds_upload_write(&upload, num_points, offset, points, count)) {
+        return false;
+    }
+    if (!dds_upload_complete(&upload)) {
+        return true;
+    }
+    emu_printf("[FNCGEN] Waveform of %d points\n", num_points);
+    /** The output is generated from dds_buffer, the table can be replaced
+        while it is playing */
+    memcpy(waveform.mv, upload.mv, num_points * sizeof(uint16_t));
+    waveform.num_points = num_points;
+    if (gen_func.value == FUNC_ARBITRARY) {
+        update_output();
+    }
+    if (persist) {
+        /** Past units must be a multiple of 4 bytes (#27) */
+        uint32_t length = sizeof(uint32_t) + ((num_points * sizeof(uint16_t) + 3) & ~3);
+        if (!waveform_past || !past_write_unit(waveform_past, (SCREEN_ID << 24) | PAST_W, (void*) &waveform, length)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
@@ -25,7 +25,19 @@
 #ifndef __FUNC_GEN_H__
 #define __FUNC_GEN_H__
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "uui.h"
+#include "dds.h"
+
+/** Most points in an arbitrary waveform */
+#define FUNC_GEN_MAX_POINTS  (DDS_BUFFER_SIZE)
+/** Most points in one upload chunk, fills a frame (see protocol.h) */
+#define FUNC_GEN_CHUNK_POINTS  (27)
+/** Most points in a waveform stored in flash. It is kept in past next to the
+    calibration and settings, and past must hold two copies of it while it
+    is rewritten. */
+#define FUNC_GEN_PERSIST_POINTS  (128)
 
 /**
  * @brief      Add the function generator to the UI
@@ -34,5 +46,22 @@
  */
 void func_gen_init(uui_t *ui);
 
+/**
+ * @brief      Write a chunk of the arbitrary waveform. The chunks must be
+ *             written in order starting at offset 0 and the waveform replaces
+ *             the current one when the chunk reaching its end is written
+ *
+ * @param[in]  num_points  number of points in the waveform, 2 to FUNC_GEN_MAX_POINTS
+ * @param[in]  offset      index of the first point in the chunk
+ * @param[in]  points      the points in mV
+ * @param[in]  count       number of points in the chunk
+ * @param[in]  persist     store the waveform in flash when it is complete,
+ *                         at most FUNC_GEN_PERSIST_POINTS points
+ *
+ * @retval     false if the chunk is out of order or out of range, the
+ *             waveform is too long to be stored or the flash write failed
+ */
+bool func_gen_write_waveform(uint32_t num_points, uint32_t offset, const uint16_t *points, uint32_t count, bool persist);
+
 #endif // __FUNC_GEN_H__
 
@@ -0,0 +1,375 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gfx-seq.h"
+#include "hw.h"
+#include "func_seq.h"
+#include "sequence.h"
+#include "swtimer.h"
+#include "tick.h"
+#include "opendps.h"
+#include "uui.h"
+#include "uui_number.h"
+#include "dbg_printf.h"
+#include "mini-printf.h"
+#include "dps-model.h"
+#include "ili9163c.h"
+#include "font-full_small.h"
+
+/*
+ * This is the implementation of the sequence screen. It runs a program of
+ * timed voltage and current steps uploaded over the serial port (see
+ * sequence.h), so the step timing does not depend on the link to the host.
+ * The output voltage and current, the running step and the number of passes
+ * of the program are shown, the number of passes is the only editable value.
+ * The output is switched off when the program ends.
+ */
+
+static void seq_enable(bool _enable);
+static void passes_changed(ui_number_t *item);
+static void seq_tick(void);
+static void activated(void);
+static void deactivated(void);
+static set_param_status_t set_parameter(char *name, char *value);
+static set_param_status_t get_parameter(char *name, char *value, uint32_t value_len);
+static void step_timer_fired(swtimer_t *timer);
+
+/* Fires at the end of each step and during ramps */
+static swtimer_t step_timer = {
+    .callback = &step_timer_fired,
+};
+
+#define SCREEN_ID  (6)
+
+/* This is the definition of the voltage item in the UI */
+ui_number_t seq_voltage = {
+    {
+        .type = ui_item_number,
+        .id = 10,
+        .x = 120,
+        .y = 15,
+        .can_focus = false,
+    },
+    .font_size = FONT_METER_MEDIUM,
+    .alignment = ui_text_right_aligned,
+    .pad_dot = false,
+    .color = COLOR_VOLTAGE,
+    .value = 0,
+    .min = 0,
+    .max = 0xffff,
+    .si_prefix = si_milli,
+    .num_digits = 2,
+    .num_decimals = 2,
+    .unit = unit_volt,
+    .changed = NULL,
+};
+
+/* This is the definition of the current item in the UI */
+ui_number_t seq_current = {
+    {
+        .type = ui_item_number,
+        .id = 11,
+        .x = 120,
+        .y = 42,
+        .can_focus = false,
+    },
+    .font_size = FONT_METER_MEDIUM,
+    .alignment = ui_text_right_aligned,
+    .pad_dot = false,
+    .color = COLOR_AMPERAGE,
+    .value = 0,
+    .min = 0,
+    .max = CONFIG_DPS_MAX_CURRENT,
+    .si_prefix = si_milli,
+    .num_digits = CURRENT_DIGITS,
+    .num_decimals = CURRENT_DECIMALS,
+    .unit = unit_ampere,
+    .changed = NULL,
+};
+
+/* This is the definition of the running step item in the UI */
+ui_number_t seq_step = {
+    {
+        .type = ui_item_number,
+        .id = 12,
+        .x = 120,
+        .y = 69,
+        .can_focus = false,
+    },
+    .font_size = FONT_FULL_SMALL,
+    .alignment = ui_text_right_aligned,
+    .pad_dot = false,
+    .color = WHITE,
+    .value = 0,
+    .min = 0,
+    .max = SEQUENCE_MAX_STEPS,
+    .si_prefix = si_none,
+    .num_digits = 2,
+    .num_decimals = 0,
+    .unit = unit_none,
+    .changed = NULL,
+};
+
+/* This is the definition of the passes item in the UI */
+ui_number_t seq_passes = {
+    {
+        .type = ui_item_number,
+        .id = 13,
+        .x = 120,
+        .y = 87,
+        .can_focus = true,
+    },
+    .font_size = FONT_FULL_SMALL,
+    .alignment = ui_text_right_aligned,
+    .pad_dot = false,
+    .color = WHITE,
+    .value = 1,
+    .min = 0, /** Run until stopped */
+    .max = SEQUENCE_MAX_PASSES,
+    .si_prefix = si_none,
+    .num_digits = 4,
+    .num_decimals = 0,
+    .unit = unit_none,
+    .changed = &passes_changed,
+};
+
+/* This is the screen definition */
+ui_screen_t seq_screen = {
+    .id = SCREEN_ID,
+    .name = "seq",
+    .icon_data = gfx_seq,
+    .icon_data_len = sizeof(gfx_seq),
+    .icon_width = GFX_SEQ_WIDTH,
+    .icon_height = GFX_SEQ_HEIGHT,
+    .activated = &activated,
+    .deactivated = &deactivated,
+    .enable = &seq_enable,
+    .past_save = NULL, /** The program is kept in RAM */
+    .past_restore = NULL,
+    .set_parameter = &set_parameter,
+    .get_parameter = &get_parameter,
+    .tick = &seq_tick,
+    .num_items = 4,
+    .parameters = {
+        {
+            .name = "passes",
+            .unit = unit_none,
+            .prefix = si_none
+        },
+        {
+            .name = "step",
+            .unit = unit_none,
+            .prefix = si_none
+        },
+        {
+            .name = "pass",
+            .unit = unit_none,
+            .prefix = si_none
+        },
+        {
+            .name = {'\0'} /** Terminator */
+        },
+    },
+    .items = { (ui_item_t*) &seq_voltage, (ui_item_t*) &seq_current,
+               (ui_item_t*) &seq_step, (ui_item_t*) &seq_passes }
+};
+
+/**
+ * @brief      Set function parameter
+ *
+ * @param[in]  name   name of parameter
+ * @param[in]  value  value of parameter as a string - always in SI units
+ *
+ * @retval     set_param_status_t status code
+ */
+static set_param_status_t set_parameter(char *name, char *value)
+{
+    int32_t ivalue = atoi(value);
+    if (strcmp("passes", name) == 0) {
+        if (ivalue < seq_passes.min || ivalue > seq_passes.max) {
+            emu_printf("[SEQ] Passes %d is out of range (min:%d max:%d)\n", ivalue, seq_passes.min, seq_passes.max);
+            return ps_range_error;
+        }
+        emu_printf("[SEQ] Setting passes to %d\n", ivalue);
+        seq_passes.value = ivalue;
+        passes_changed(&seq_passes);
+        return ps_ok;
+    } else if (strcmp("step", name) == 0 || strcmp("pass", name) == 0) {
+        /** Progress, read only */
+        return ps_not_supported;
+    }
+    return ps_unknown_name;
+}
+
+/**
+ * @brief      Get function parameter
+ *
+ * @param[in]  name       name of parameter
+ * @param[in]  value      value of parameter as a string - always in SI units
+ * @param[in]  value_len  length of value buffer
+ *
+ * @retval     set_param_status_t status code
+ */
+static set_param_status_t get_parameter(char *name, char *value, uint32_t value_len)
+{
+    uint32_t step, pass;
+    (void) sequence_progress(&step, &pass);
+    if (strcmp("passes", name) == 0) {
+        (void) mini_snprintf(value, value_len, "%d", sequence_passes());
+        return ps_ok;
+    } else if (strcmp("step", name) == 0) {
+        (void) mini_snprintf(value, value_len, "%d", step);
+        return ps_ok;
+    } else if (strcmp("pass", name) == 0) {
+        (void) mini_snprintf(value, value_len, "%d", pass);
+        return ps_ok;
+    }
+    return ps_unknown_name;
+}
+
+/**
+ * @brief      Apply the settings of the running step and schedule the next
+ *             update. The output is switched off when the program has ended.
+ *
+ * @param      timer  The step timer
+ */
+static void step_timer_fired(swtimer_t *timer)
+{
+    uint32_t mv, ma;
+    uint64_t now = get_ticks();
+    uint64_t next = sequence_update(now, &mv, &ma);
+    if (next == SEQUENCE_END) {
+        /** Same as pressing the enable button */
+        (void) opendps_enable_output(false);
+        return;
+    }
+    (void) pwrctl_set_vout(mv);
+    (void) pwrctl_set_iout(ma);
+    swtimer_start(timer, next - now, 0);
+}
+
+/**
+ * @brief      Callback for when the function is enabled
+ *
+ * @param[in]  enabled  true when function is enabled
+ */
+static void seq_enable(bool enabled)
+{
+    emu_printf("[SEQ] %s output\n", enabled ? "Enable" : "Disable");
+    if (enabled) {
+        (void) pwrctl_set_vlimit(0xFFFF); /** Set the voltage limit to the maximum to prevent OVP (over voltage protection) firing */
+        (void) pwrctl_set_ilimit(0xFFFF); /** Set the current limit to the maximum to prevent OCP (over current protection) firing */
+        if (sequence_start(get_ticks())) {
+            /** Sets the output to the first step */
+            step_timer_fired(&step_timer);
+            pwrctl_enable_vout(true);
+        } else {
+            /** No program, the screen is switched off again from the main loop */
+            swtimer_start(&step_timer, 0, 0);
+        }
+    } else {
+        swtimer_stop(&step_timer);
+        sequence_stop();
+        pwrctl_enable_vout(false);
+        seq_voltage.value = 0;
+        seq_voltage.ui.draw(&seq_voltage.ui);
+        seq_current.value = 0;
+        seq_current.ui.draw(&seq_current.ui);
+    }
+}
+
+/**
+ * @brief      Callback for when value of the passes item is changed
+ *
+ * @param      item  The passes item
+ */
+static void passes_changed(ui_number_t *item)
+{
+    sequence_set_passes(item->value);
+}
+
+/**
+ * @brief      Set up any static graphics when the screen is first drawn
+ */
+static void activated(void)
+{
+    /** The screen is different here, let's clear it */
+    tft_clear();
+    for (uint32_t i = 0; i < seq_screen.num_items; i++) {
+        seq_screen.items[i]->draw(seq_screen.items[i]);
+    }
+    tft_puts(FONT_FULL_SMALL, "Vout:", 6, 15+FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, 64, 20, WHITE, false);
+    tft_puts(FONT_FULL_SMALL, "Iout:", 6, 42+FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, 64, 20, WHITE, false);
+    tft_puts(FONT_FULL_SMALL, "Step:", 6, 69+FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, 64, 20, WHITE, false);
+    tft_puts(FONT_FULL_SMALL, "Passes:", 6, 87+FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, 64, 20, WHITE, false);
+}
+
+/**
+ * @brief      Do any required clean up before changing away from this screen
+ */
+static void deactivated(void)
+{
+    tft_clear();
+}
+
+/**
+ * @brief      Update the UI with the output and the progress of the program
+ */
+static void seq_tick(void)
+{
+    uint16_t i_out_raw, v_in_raw, v_out_raw;
+    uint32_t step, pass;
+    hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
+    (void) v_in_raw;
+    if (pwrctl_vout_enabled()) {
+        (void) number_update(&seq_voltage, pwrctl_calc_vout(v_out_raw));
+        (void) number_update(&seq_current, pwrctl_calc_iout(i_out_raw));
+    }
+    (void) sequence_progress(&step, &pass);
+    (void) number_update(&seq_step, step);
+    if (!seq_passes.ui.has_focus) {
+        /** The host may have uploaded a program with another number of passes */
+        (void) number_update(&seq_passes, sequence_passes());
+    }
+}
+
+/**
+ * @brief      Initialise the sequence module and add its screen to the UI
+ *
+ * @param      ui    The user interface
+ */
+void func_seq_init(uui_t *ui)
+{
+    sequence_set_passes(seq_passes.value);
+    number_init(&seq_voltage);
+    number_init(&seq_current);
+    number_init(&seq_step);
+    number_init(&seq_passes);
+    uui_add_screen(ui, &seq_screen);
+}
@@ -4,7 +4,6 @@
 import argparse
 import sys
 import os
-import socket
 try:
     from PIL import Image
     from PIL import ImageDraw
@@ -38,7 +37,7 @@ def image_to_mono2bpp(im):
     return mono2array
 
 """
-Convert an image to a bgr565 byte array
+Convert an image to a list of bgr565 pixels
 """
 def image_to_bgr565(im):
     image_bytes = im.tobytes("raw", "RGB") # Create a byte array in 24 bit RGB format from an image
@@ -46,12 +45,44 @@ def image_to_bgr565(im):
     # Convert 24-bit RGB to 16-bit BGR
     bgr565array = []
     for x in range(len(image_bytes) // 3):
-        bgr565 = rgb888_to_bgr565(image_bytes[x*3], image_bytes[x*3+1], image_bytes[x*3+2])
-        bgr565array.append((bgr565 >> 8) & 0xFF)
-        bgr565array.append(bgr565 & 0xFF)
+        bgr565array.append(rgb888_to_bgr565(image_bytes[x*3], image_bytes[x*3+1], image_bytes[x*3+2]))
 
     return bgr565array
 
+RLE_RUN = 0x8000 # Packet header flag for runs
+RLE_MAX_COUNT = 0x7FFF # Max number of pixels in one packet
+RLE_MIN_RUN = 4 # Shorter runs are cheaper to send as literals than as a separate fill
+
+"""
+Run length encode a list of bgr565 pixels for tft_blit_rle(...)
+Each packet starts with a header word:
+  - RLE_RUN | n: a run, the next word is a pixel repeated n times
+  - n: a literal, the next n words are pixels
+"""
+def rle_encode_bgr565(pixels):
+    rle = []
+    literal = []
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < RLE_MAX_COUNT:
+            j += 1
+        if j - i >= RLE_MIN_RUN:
+            if literal:
+                rle += [len(literal)] + literal
+                literal = []
+            rle += [RLE_RUN | (j - i), pixels[i]]
+            i = j
+        else:
+            literal.append(pixels[i])
+            if len(literal) == RLE_MAX_COUNT:
+                rle += [len(literal)] + literal
+                literal = []
+            i += 1
+    if literal:
+        rle += [len(literal)] + literal
+    return rle
+
 """
 Generate the lookup table for bytes consisting of packed 2bpp pixels
 """
@@ -75,6 +106,7 @@ def generate_pixel_lookup_table(output_filename):
   *   - Two 2-bit pixels at a time means the result is a pair of two 16-bit bgr565 pixels -- a single uint32_t is used to describe both in one value
   *   - Originally, this was a 256-entry uint64_t array, and allowed expanding all 4 pixels for an input byte in a single operation
   *   - The 64-bit table used a lot more flash space.
+  * The pixels are in native byte order, the decoded glyphs are sent to the TFT using 16-bit SPI frames.
 """
 
     # Generate the C source file
@@ -87,8 +119,8 @@ def generate_pixel_lookup_table(output_filename):
             source_file.write("\n   ")
         a = int(((n >> 2) & 0x3) * 255.0 / 3.0)
         b = int(((n >> 0) & 0x3) * 255.0 / 3.0)
-        a565 = socket.htons(rgb888_to_bgr565(a, a, a))
-        b565 = socket.htons(rgb888_to_bgr565(b, b, b))
+        a565 = rgb888_to_bgr565(a, a, a)
+        b565 = rgb888_to_bgr565(b, b, b)
         source_file.write(" 0x%04X%04X," % (a565,b565))
     source_file.write("\n};\n")
 
@@ -291,7 +323,7 @@ def convert_font_to_c(font_fname, characters, font_size, font_spacing, output_fi
     font_header_file.close()
 
 """
-Convert the specified font to a pair of .c/.h C language lookup tables in BGR565 format
+Convert the specified graphic to a pair of .c/.h C language lookup tables in run length encoded BGR565 format
 """
 def convert_graphic_to_c(graphic_fname, output_filename):
     print(f"Converting {graphic_fname} to gfx-{output_filename}.c/h")
@@ -301,8 +333,8 @@ def convert_graphic_to_c(graphic_fname, output_filename):
     # Get image dimensions
     (width, height) = graphic_image.size
 
-    # Convert image to bgr565 byte list
-    graphic_data = image_to_bgr565(graphic_image)
+    # Convert image to a run length encoded bgr565 list
+    graphic_data = rle_encode_bgr565(image_to_bgr565(graphic_image))
 
     # Generate the output filenames
     gfx_source_filename = "gfx-%s.c" % (output_filename)
@@ -316,14 +348,15 @@ def convert_graphic_to_c(graphic_fname, output_filename):
     gfx_source_file.write("#include \"%s\"\n\n" % (gfx_header_filename))
 
     # Generate image data lookup table
-    gfx_source_file.write("const uint8_t gfx_%s[%d] = {\n  " % (output_filename, len(graphic_data)))
+    gfx_source_file.write("/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */\n")
+    gfx_source_file.write("const uint16_t gfx_%s[%d] = {\n  " % (output_filename, len(graphic_data)))
     count = 0
     for j in graphic_data:
-        gfx_source_file.write("{0:#04x}".format(j))
+        gfx_source_file.write("{0:#06x}".format(j))
         count += 1
         if count < len(graphic_data):
             gfx_source_file.write(", ")
-            if not (count % 16): # Place a new line every 16 values
+            if not (count % 8): # Place a new line every 8 values
                 gfx_source_file.write("\n  ")
     gfx_source_file.write("\n};")
 
@@ -342,7 +375,7 @@ def convert_graphic_to_c(graphic_fname, output_filename):
     gfx_header_file.write("#define GFX_%s_HEIGHT (%d)\n" % (output_filename.upper(), height))
     gfx_header_file.write("#define GFX_%s_WIDTH  (%d)\n\n" % (output_filename.upper(), width))
 
-    gfx_header_file.write("extern const uint8_t gfx_%s[%d];\n\n" % (output_filename, len(graphic_data)))
+    gfx_header_file.write("extern const uint16_t gfx_%s[%d];\n\n" % (output_filename, len(graphic_data)))
 
     gfx_header_file.write("#endif // __GFX_%s_H__" % (output_filename.upper()))
 
@@ -0,0 +1,31 @@
+/** Gfx generated from `./gen_lookup.py -i gfx/png/arb.png -o arb` */
+
+#include "gfx-arb.h"
+
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_arb[187] = {
+  0x8040, 0x0000, 0x0001, 0x2104, 0x8005, 0x39e7, 0x0001, 0x39c7, 
+  0x8013, 0x0000, 0x0001, 0x31a6, 0x8004, 0x39e7, 0x0002, 0x2144, 
+  0x94b2, 0x8006, 0xffff, 0x0001, 0x632c, 0x8011, 0x0000, 0x0001, 
+  0x8430, 0x8005, 0xffff, 0x0009, 0xbdf7, 0x4208, 0x7bcf, 0x7bcf, 
+  0x7bef, 0x7bcf, 0x8430, 0xf7de, 0xbdf7, 0x800c, 0x0000, 0x000c, 
+  0x3186, 0x0000, 0x0000, 0x0000, 0x4a69, 0xffff, 0xd6ba, 0x7bcf, 
+  0x7bef, 0x7bcf, 0x7bcf, 0x528a, 0x8006, 0x0000, 0x0003, 0xdefb, 
+  0xef7d, 0x0841, 0x8009, 0x0000, 0x0009, 0x0841, 0xa554, 0xffff, 
+  0xbdf7, 0x2104, 0x18c3, 0xe75c, 0xef9d, 0x2965, 0x8009, 0x0000, 
+  0x0005, 0x0020, 0x0000, 0xa514, 0xffff, 0x2965, 0x8008, 0x0000, 
+  0x000b, 0x18c3, 0xc638, 0xffff, 0xc638, 0xffff, 0xf7be, 0xd69a, 
+  0xffff, 0x632c, 0x0000, 0x0020, 0x800a, 0x0000, 0x0003, 0x634c, 
+  0xf7de, 0x630c, 0x8007, 0x0000, 0x0009, 0x2965, 0xd6da, 0xffff, 
+  0x9492, 0x0000, 0x31c6, 0xce99, 0xffff, 0x9d13, 0x800d, 0x0000, 
+  0x0003, 0x31a6, 0xffff, 0x9cf3, 0x8006, 0x0000, 0x000a, 0x4208, 
+  0xef7d, 0xffff, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a89, 
+  0x0020, 0x800d, 0x0000, 0x0003, 0x0841, 0xef9d, 0xd6ba, 0x8005, 
+  0x0000, 0x0004, 0x5acb, 0xffff, 0xffff, 0x5acb, 0x8015, 0x0000, 
+  0x000a, 0xbdf7, 0xf7de, 0x0861, 0x0000, 0x0000, 0x0000, 0x73ae, 
+  0xffff, 0xef7d, 0x4208, 0x8016, 0x0000, 0x0009, 0x8450, 0xf7de, 
+  0x6b6d, 0x39e7, 0x39e7, 0x8c91, 0xffff, 0xd6da, 0x2965, 0x8017, 
+  0x0000, 0x0001, 0x4a49, 0x8005, 0xffff, 0x0002, 0xc638, 0x18c3, 
+  0x8019, 0x0000, 0x0006, 0x5aeb, 0x7bcf, 0x73ae, 0x73ce, 0x634c, 
+  0x0841, 0x8032, 0x0000
+};
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_CC_HEIGHT (15)
 #define GFX_CC_WIDTH  (16)
 
-extern const uint8_t gfx_cc[480];
+extern const uint16_t gfx_cc[189];
 
 #endif // __GFX_CC_H__
\ No newline at end of file
@@ -2,35 +2,28 @@
 
 #include "gfx-cl.h"
 
-const uint8_t gfx_cl[480] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x31, 0xa6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x21, 0x04, 0xc6, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xde, 0xfb, 0xf7, 0xbe, 0x63, 0x2c, 0x29, 0x65, 0x52, 0x8a, 0x73, 0xce, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0x8a, 0xff, 0xff, 0x63, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xad, 0x55, 0xf7, 0xde, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xce, 0x59, 0xd6, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0x3c, 0xc6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf7, 0xde, 0xb5, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0x3c, 0xc6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xce, 0x79, 0xde, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xa5, 0x54, 0xff, 0xff, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0x49, 0xff, 0xff, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xce, 0x99, 0xf7, 0xde, 0x7b, 0xef, 0x31, 0xa6, 0x42, 0x48, 0x8c, 0x71, 0x00, 0x00, 
-  0x00, 0x00, 0xe7, 0x5c, 0x7c, 0x0f, 0x7c, 0x0f, 0x7c, 0x0f, 0x7c, 0x0f, 0x7c, 0x0f, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x82, 0xb5, 0xd6, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0x08, 0x41, 
-  0x00, 0x00, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x31, 0xc6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0x31, 0xc6, 0x31, 0xc6, 0x18, 0xe3, 0x18, 0xe3, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_cl[169] = {
+  0x0006, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x18e3, 0x800b, 
+  0x0000, 0x000a, 0x2104, 0xc658, 0xffff, 0xffff, 0xffff, 0xbdf7, 
+  0x0000, 0x0000, 0xe75c, 0x7c0f, 0x8006, 0x0000, 0x000a, 0xdefb, 
+  0xf7be, 0x632c, 0x2965, 0x528a, 0x73ce, 0x0000, 0x0000, 0xe75c, 
+  0x7c0f, 0x8005, 0x0000, 0x0003, 0x528a, 0xffff, 0x634c, 0x8006, 
+  0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8005, 0x0000, 0x0003, 0xad55, 
+  0xf7de, 0x1082, 0x8006, 0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8005, 
+  0x0000, 0x0002, 0xce59, 0xd6ba, 0x8007, 0x0000, 0x0002, 0xe75c, 
+  0x7c0f, 0x8005, 0x0000, 0x0002, 0xe73c, 0xc638, 0x8007, 0x0000, 
+  0x0002, 0xe75c, 0x7c0f, 0x8005, 0x0000, 0x0002, 0xf7de, 0xb5d6, 
+  0x8007, 0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8005, 0x0000, 0x0002, 
+  0xe73c, 0xc658, 0x8007, 0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8005, 
+  0x0000, 0x0002, 0xce79, 0xdefb, 0x8007, 0x0000, 0x0002, 0xe75c, 
+  0x7c0f, 0x8005, 0x0000, 0x0003, 0xa554, 0xffff, 0x18e3, 0x8006, 
+  0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8005, 0x0000, 0x0003, 0x4a49, 
+  0xffff, 0x7c0f, 0x8006, 0x0000, 0x0002, 0xe75c, 0x7c0f, 0x8006, 
+  0x0000, 0x0009, 0xce99, 0xf7de, 0x7bef, 0x31a6, 0x4248, 0x8c71, 
+  0x0000, 0x0000, 0xe75c, 0x8005, 0x7c0f, 0x000a, 0x0000, 0x0000, 
+  0x1082, 0xb5d6, 0xf7de, 0xffff, 0xffff, 0xce79, 0x0841, 0x0000, 
+  0x8006, 0xe75c, 0x8004, 0x0000, 0x0003, 0x0861, 0x31c6, 0x18e3, 
+  0x8004, 0x0000, 0x0006, 0x18e3, 0x31c6, 0x31c6, 0x18e3, 0x18e3, 
+  0x0000
 };
\ No newline at end of file
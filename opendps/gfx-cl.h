@@ -8,6 +8,6 @@
 #define GFX_CL_HEIGHT (15)
 #define GFX_CL_WIDTH  (16)
 
-extern const uint8_t gfx_cl[480];
+extern const uint16_t gfx_cl[169];
 
 #endif // __GFX_CL_H__
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_CROSSHAIR_HEIGHT (15)
 #define GFX_CROSSHAIR_WIDTH  (16)
 
-extern const uint8_t gfx_crosshair[480];
+extern const uint16_t gfx_crosshair[144];
 
 #endif // __GFX_CROSSHAIR_H__
\ No newline at end of file
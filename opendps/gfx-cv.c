@@ -2,35 +2,31 @@
 
 #include "gfx-cv.h"
 
-const uint8_t gfx_cv[480] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x31, 0xa6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x21, 0x04, 0xc6, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x84, 0x30, 
-  0xff, 0xff, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0xff, 0xff, 0x7b, 0xcf, 
-  0x00, 0x00, 0xde, 0xfb, 0xf7, 0xbe, 0x63, 0x2c, 0x29, 0x65, 0x52, 0x8a, 0x73, 0xce, 0x52, 0xaa, 
-  0xff, 0xff, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x69, 0xff, 0xff, 0x42, 0x28, 
-  0x52, 0x8a, 0xff, 0xff, 0x63, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 
-  0xff, 0xff, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0xff, 0xff, 0x10, 0x82, 
-  0xad, 0x55, 0xf7, 0xde, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0x5c, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0xde, 0xfb, 0x00, 0x00, 
-  0xce, 0x59, 0xd6, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xad, 0x95, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x1b, 0xa5, 0x34, 0x00, 0x00, 
-  0xe7, 0x3c, 0xc6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x73, 0xae, 0xff, 0xff, 0x18, 0xc3, 0x00, 0x00, 0x18, 0xc3, 0xff, 0xff, 0x63, 0x2c, 0x00, 0x00, 
-  0xf7, 0xde, 0xb5, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x31, 0xa6, 0xff, 0xff, 0x52, 0xaa, 0x00, 0x00, 0x52, 0xaa, 0xff, 0xff, 0x29, 0x45, 0x00, 0x00, 
-  0xe7, 0x3c, 0xc6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x20, 0xef, 0x9d, 0x94, 0xb2, 0x00, 0x00, 0x94, 0xb2, 0xe7, 0x3c, 0x00, 0x00, 0x00, 0x00, 
-  0xce, 0x79, 0xde, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xad, 0x75, 0xce, 0x99, 0x00, 0x00, 0xce, 0x99, 0x9d, 0x13, 0x00, 0x00, 0x00, 0x00, 
-  0xa5, 0x54, 0xff, 0xff, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x6b, 0x4d, 0xff, 0xff, 0x29, 0x65, 0xff, 0xff, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0x49, 0xff, 0xff, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x21, 0x24, 0xff, 0xff, 0xb5, 0x96, 0xf7, 0xde, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xce, 0x99, 0xf7, 0xde, 0x7b, 0xef, 0x31, 0xa6, 0x42, 0x48, 0x8c, 0x71, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd6, 0xba, 0xff, 0xff, 0xc6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x82, 0xb5, 0xd6, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0x08, 0x41, 
-  0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0xff, 0xff, 0x7b, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x31, 0xc6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_cv[196] = {
+  0x0006, 0x0000, 0x0000, 0x0000, 0x18c3, 0x31a6, 0x18e3, 0x800b, 
+  0x0000, 0x0022, 0x2104, 0xc658, 0xffff, 0xffff, 0xffff, 0xbdf7, 
+  0x8430, 0xffff, 0x2104, 0x0000, 0x0000, 0x0000, 0x2104, 0xffff, 
+  0x7bcf, 0x0000, 0xdefb, 0xf7be, 0x632c, 0x2965, 0x528a, 0x73ce, 
+  0x52aa, 0xffff, 0x4a69, 0x0000, 0x0000, 0x0000, 0x4a69, 0xffff, 
+  0x4228, 0x528a, 0xffff, 0x634c, 0x8004, 0x0000, 0x000c, 0x2104, 
+  0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0x1082, 
+  0xad55, 0xf7de, 0x1082, 0x8005, 0x0000, 0x000a, 0xe75c, 0xad75, 
+  0x0000, 0x0000, 0x0000, 0xad75, 0xdefb, 0x0000, 0xce59, 0xd6ba, 
+  0x8006, 0x0000, 0x000a, 0xad95, 0xdf1b, 0x0000, 0x0000, 0x0000, 
+  0xdf1b, 0xa534, 0x0000, 0xe73c, 0xc638, 0x8006, 0x0000, 0x000a, 
+  0x73ae, 0xffff, 0x18c3, 0x0000, 0x18c3, 0xffff, 0x632c, 0x0000, 
+  0xf7de, 0xb5d6, 0x8006, 0x0000, 0x000a, 0x31a6, 0xffff, 0x52aa, 
+  0x0000, 0x52aa, 0xffff, 0x2945, 0x0000, 0xe73c, 0xc658, 0x8006, 
+  0x0000, 0x000a, 0x0020, 0xef9d, 0x94b2, 0x0000, 0x94b2, 0xe73c, 
+  0x0000, 0x0000, 0xce79, 0xdefb, 0x8007, 0x0000, 0x000a, 0xad75, 
+  0xce99, 0x0000, 0xce99, 0x9d13, 0x0000, 0x0000, 0xa554, 0xffff, 
+  0x18e3, 0x8006, 0x0000, 0x000a, 0x6b4d, 0xffff, 0x2965, 0xffff, 
+  0x5aeb, 0x0000, 0x0000, 0x4a49, 0xffff, 0x7c0f, 0x8006, 0x0000, 
+  0x0014, 0x2124, 0xffff, 0xb596, 0xf7de, 0x10a2, 0x0000, 0x0000, 
+  0x0000, 0xce99, 0xf7de, 0x7bef, 0x31a6, 0x4248, 0x8c71, 0x0000, 
+  0x0000, 0x0000, 0xd6ba, 0xffff, 0xc658, 0x8004, 0x0000, 0x000c, 
+  0x1082, 0xb5d6, 0xf7de, 0xffff, 0xffff, 0xce79, 0x0841, 0x0000, 
+  0x0000, 0x8c51, 0xffff, 0x7bef, 0x8006, 0x0000, 0x0003, 0x0861, 
+  0x31c6, 0x18e3, 0x800a, 0x0000
 };
\ No newline at end of file
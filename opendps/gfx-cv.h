@@ -8,6 +8,6 @@
 #define GFX_CV_HEIGHT (15)
 #define GFX_CV_WIDTH  (16)
 
-extern const uint8_t gfx_cv[480];
+extern const uint16_t gfx_cv[196];
 
 #endif // __GFX_CV_H__
\ No newline at end of file
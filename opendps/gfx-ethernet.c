@@ -1,44 +1,44 @@
-/** Gfx generated from `gen_lookup.py -i gfx/png/ethernet.png -o ethernet` */
+/** Gfx generated from `./gen_lookup.py -i gfx/png/ethernet.png -o ethernet` */
 
 #include "gfx-ethernet.h"
 
-const uint8_t gfx_ethernet[608] = {
-  0x7b, 0xef, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x63, 0x4c, 0x63, 0x0c, 0x6b, 0x6d, 
-  0x6b, 0x8d, 0x6b, 0x6d, 0x6b, 0x6d, 0x73, 0xae, 0x73, 0xce, 0x73, 0xae, 0x7b, 0xcf, 0x7b, 0xef, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 
-  0x63, 0x2c, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x6d, 0x6b, 0x8d, 0x6b, 0x6d, 0x73, 0xae, 0x73, 0xae, 
-  0x73, 0xce, 0x73, 0xce, 0x6b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 
-  0x5a, 0xeb, 0x5a, 0xeb, 0x5b, 0x0b, 0x63, 0x2c, 0x63, 0x4c, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x6d, 
-  0x73, 0x8e, 0x73, 0xae, 0x73, 0xce, 0x7b, 0xcf, 0x7b, 0xcf, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x6b, 0x4d, 
-  0x6b, 0x4d, 0x6b, 0x6d, 0x73, 0x8e, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xce, 
-  0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xeb, 0x5b, 0x0b, 
-  0x63, 0x0c, 0x63, 0x2c, 0x63, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x73, 0xae, 0x73, 0xae, 
-  0x7b, 0xef, 0x7b, 0xcf, 0x7b, 0xef, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 
-  0x5a, 0xcb, 0x5a, 0xcb, 0x5b, 0x0b, 0x5b, 0x0b, 0x63, 0x2c, 0x73, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-  0x73, 0x8e, 0x73, 0x8e, 0x73, 0xae, 0x73, 0xce, 0x73, 0xce, 0x7b, 0xcf, 0x73, 0xce, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xae, 0x73, 0xce, 
-  0x73, 0xae, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xeb, 
-  0x5b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x7b, 0xef, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0xaa, 0x52, 0xaa, 0x5a, 0xeb, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x73, 0xae, 0x7b, 0xef, 0x7b, 0xcf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xeb, 0x00, 0x00, 
-  0x63, 0x2c, 0x7b, 0xef, 0x5a, 0xeb, 0x5a, 0xeb, 0x7b, 0xef, 0x7b, 0xef, 0x00, 0x00, 0x7b, 0xef, 
-  0x73, 0xce, 0x7b, 0xcf, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 
-  0x52, 0xca, 0x52, 0xaa, 0x5a, 0xeb, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x6d, 0x73, 0x8e, 
-  0x73, 0xae, 0x7b, 0xef, 0x73, 0x8e, 0x7b, 0xef, 0x73, 0xce, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x52, 0xaa, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xcb, 0x6b, 0x4d, 0x63, 0x2c, 0x63, 0x0c, 
-  0x63, 0x0c, 0x6b, 0x8d, 0x6b, 0x4d, 0x73, 0xae, 0x7b, 0xef, 0x7b, 0xef, 0x73, 0xae, 0x7b, 0xcf, 
-  0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xcb, 0x52, 0xaa, 0x5a, 0xeb, 0x5a, 0xeb, 
-  0x63, 0x0c, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x6d, 0x6b, 0x6d, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0xce, 
-  0x73, 0xae, 0x73, 0xae, 0x73, 0xce, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 
-  0x52, 0xaa, 0x5a, 0xeb, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x8d, 
-  0x73, 0xae, 0x6b, 0x6d, 0x73, 0xce, 0x73, 0xae, 0x7b, 0xef, 0x7b, 0xcf, 0x73, 0xae, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xeb, 0x5b, 0x0b, 0x63, 0x4c, 
-  0x63, 0x4c, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x8d, 0x73, 0x8e, 0x73, 0xae, 0x73, 0xae, 0x7b, 0xef, 
-  0x73, 0xce, 0x73, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x52, 0xaa, 0x5a, 0xcb, 
-  0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x8d, 0x6b, 0x6d, 0x73, 0xae, 
-  0x73, 0xae, 0x7b, 0xcf, 0x73, 0xae, 0x73, 0xae, 0x7b, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_ethernet[289] = {
+  0x0043, 0x7bef, 0x5acb, 0x5acb, 0x5aeb, 0x5aeb, 0x634c, 0x630c, 
+  0x6b6d, 0x6b8d, 0x6b6d, 0x6b6d, 0x73ae, 0x73ce, 0x73ae, 0x7bcf, 
+  0x7bef, 0x0000, 0x0000, 0x0000, 0x52aa, 0x52ca, 0x5aeb, 0x5aeb, 
+  0x5aeb, 0x632c, 0x632c, 0x6b4d, 0x6b6d, 0x6b8d, 0x6b6d, 0x73ae, 
+  0x73ae, 0x73ce, 0x73ce, 0x6b8d, 0x0000, 0x0000, 0x0000, 0x52aa, 
+  0x5acb, 0x5aeb, 0x5aeb, 0x5b0b, 0x632c, 0x634c, 0x6b4d, 0x6b4d, 
+  0x6b6d, 0x738e, 0x73ae, 0x73ce, 0x7bcf, 0x7bcf, 0x73ce, 0x0000, 
+  0x0000, 0x0000, 0x52aa, 0x5acb, 0x5aeb, 0x5aeb, 0x630c, 0x632c, 
+  0x6b4d, 0x6b4d, 0x6b6d, 0x738e, 0x8004, 0x73ae, 0x002f, 0x73ce, 
+  0x73ae, 0x0000, 0x0000, 0x0000, 0x52aa, 0x5acb, 0x5aeb, 0x5b0b, 
+  0x630c, 0x632c, 0x632c, 0x0000, 0x0000, 0x6b6d, 0x73ae, 0x73ae, 
+  0x7bef, 0x7bcf, 0x7bef, 0x7c0f, 0x0000, 0x0000, 0x0000, 0x52aa, 
+  0x5acb, 0x5acb, 0x5b0b, 0x5b0b, 0x632c, 0x738e, 0x0000, 0x0000, 
+  0x738e, 0x738e, 0x73ae, 0x73ce, 0x73ce, 0x7bcf, 0x73ce, 0x0000, 
+  0x0000, 0x0000, 0x52aa, 0x5acb, 0x5aeb, 0x5acb, 0x8008, 0x0000, 
+  0x000b, 0x73ae, 0x73ce, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 
+  0x52aa, 0x52ca, 0x5aeb, 0x5b0b, 0x8008, 0x0000, 0x000b, 0x7bef, 
+  0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x52aa, 0x52aa, 
+  0x5aeb, 0x5aeb, 0x8008, 0x0000, 0x008c, 0x7bef, 0x73ae, 0x7bef, 
+  0x7bcf, 0x0000, 0x0000, 0x0000, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 
+  0x0000, 0x632c, 0x7bef, 0x5aeb, 0x5aeb, 0x7bef, 0x7bef, 0x0000, 
+  0x7bef, 0x73ce, 0x7bcf, 0x73ae, 0x0000, 0x0000, 0x0000, 0x52aa, 
+  0x5acb, 0x52ca, 0x52aa, 0x5aeb, 0x632c, 0x6b4d, 0x6b4d, 0x6b6d, 
+  0x738e, 0x73ae, 0x7bef, 0x738e, 0x7bef, 0x73ce, 0x73ae, 0x0000, 
+  0x0000, 0x0000, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x6b4d, 0x632c, 
+  0x630c, 0x630c, 0x6b8d, 0x6b4d, 0x73ae, 0x7bef, 0x7bef, 0x73ae, 
+  0x7bcf, 0x73ae, 0x0000, 0x0000, 0x0000, 0x5acb, 0x52aa, 0x5aeb, 
+  0x5aeb, 0x630c, 0x632c, 0x6b4d, 0x6b6d, 0x6b6d, 0x738e, 0x738e, 
+  0x73ce, 0x73ae, 0x73ae, 0x73ce, 0x73ae, 0x0000, 0x0000, 0x0000, 
+  0x52aa, 0x52aa, 0x5aeb, 0x5aeb, 0x630c, 0x632c, 0x6b4d, 0x6b4d, 
+  0x6b8d, 0x73ae, 0x6b6d, 0x73ce, 0x73ae, 0x7bef, 0x7bcf, 0x73ae, 
+  0x0000, 0x0000, 0x0000, 0x52aa, 0x5acb, 0x5acb, 0x5aeb, 0x5b0b, 
+  0x634c, 0x634c, 0x6b6d, 0x6b6d, 0x6b8d, 0x738e, 0x73ae, 0x73ae, 
+  0x7bef, 0x73ce, 0x73ae, 0x0000, 0x0000, 0x0000, 0x52aa, 0x52aa, 
+  0x5acb, 0x5aeb, 0x630c, 0x632c, 0x632c, 0x6b4d, 0x6b8d, 0x6b6d, 
+  0x73ae, 0x73ae, 0x7bcf, 0x73ae, 0x73ae, 0x7bef, 0x0000, 0x0000, 
+  0x0000
 };
\ No newline at end of file
@@ -1,4 +1,4 @@
-/** Gfx generated from `gen_lookup.py -i gfx/png/ethernet.png -o ethernet` */
+/** Gfx generated from `./gen_lookup.py -i gfx/png/ethernet.png -o ethernet` */
 
 #ifndef __GFX_ETHERNET_H__
 #define __GFX_ETHERNET_H__
@@ -8,6 +8,6 @@
 #define GFX_ETHERNET_HEIGHT (16)
 #define GFX_ETHERNET_WIDTH  (19)
 
-extern const uint8_t gfx_ethernet[608];
+extern const uint16_t gfx_ethernet[289];
 
 #endif // __GFX_ETHERNET_H__
\ No newline at end of file
@@ -0,0 +1,206 @@
+/** Gfx generated from `./gen_lookup.py -i gfx/png/logo.png -o logo` */
+
+#include "gfx-logo.h"
+
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_logo[1592] = {
+  0x8007, 0x0000, 0x0002, 0x18e3, 0x2945, 0x8057, 0x0000, 0x0003, 
+  0x18e3, 0x39c7, 0x18e3, 0x8007, 0x0000, 0x0008, 0x31a6, 0x9d13, 
+  0xdefb, 0xffff, 0xffff, 0xe75c, 0xad75, 0x4a69, 0x8031, 0x0000, 
+  0x0009, 0x8c91, 0xbdf7, 0xdf1b, 0xf7be, 0xf7be, 0xd6ba, 0xad75, 
+  0x8430, 0x2104, 0x8008, 0x0000, 0x0009, 0x39e7, 0x94d2, 0xb5d6, 
+  0xd6da, 0xf7be, 0xdefb, 0xbdf7, 0x8c71, 0x18c3, 0x8006, 0x0000, 
+  0x000e, 0x0841, 0x7c0f, 0xef7d, 0xffff, 0xffff, 0xffff, 0xef9d, 
+  0x94b2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x3a07, 0xef9d, 0x8006, 
+  0xffff, 0x0002, 0xf7de, 0x630c, 0x8030, 0x0000, 0x8008, 0xffff, 
+  0x0002, 0xef9d, 0x6b8d, 0x8007, 0x0000, 0x0001, 0x73ce, 0x8007, 
+  0xffff, 0x0002, 0xef9d, 0x73ce, 0x8004, 0x0000, 0x0002, 0x0841, 
+  0xd69a, 0x8006, 0xffff, 0x0010, 0xf7be, 0x1082, 0x0000, 0x0000, 
+  0x4208, 0xf7be, 0xffff, 0xf7be, 0x8c91, 0x4228, 0x31c6, 0x8430, 
+  0xe75c, 0xffff, 0xf7de, 0x632c, 0x802f, 0x0000, 0x000b, 0xffff, 
+  0xffff, 0xd69a, 0x632c, 0x632c, 0x8c51, 0xb5b6, 0xef9d, 0xffff, 
+  0xffff, 0xb5d6, 0x8006, 0x0000, 0x001e, 0x73ce, 0xffff, 0xffff, 
+  0x8c71, 0x630c, 0x73ce, 0xad95, 0xffff, 0xffff, 0xffff, 0x4a69, 
+  0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xb5d6, 0x5aeb, 
+  0x1082, 0x2104, 0x634c, 0x8430, 0x0000, 0x0000, 0x0000, 0xce59, 
+  0xffff, 0xffff, 0x630c, 0x8004, 0x0000, 0x0005, 0x39c7, 0xf7be, 
+  0xffff, 0xef7d, 0x0841, 0x802e, 0x0000, 0x0003, 0xffff, 0xffff, 
+  0xad75, 0x8004, 0x0000, 0x0005, 0x2965, 0xd6da, 0xffff, 0xffff, 
+  0x52ca, 0x8005, 0x0000, 0x0011, 0x73ce, 0xffff, 0xffff, 0x31a6, 
+  0x0000, 0x0000, 0x0000, 0x528a, 0xffff, 0xffff, 0xe73c, 0x0841, 
+  0x0000, 0x0841, 0xf7de, 0xffff, 0xbdf7, 0x8008, 0x0000, 0x0004, 
+  0x3186, 0xffff, 0xffff, 0xa554, 0x8006, 0x0000, 0x0004, 0x7bcf, 
+  0xffff, 0xffff, 0x5aeb, 0x8007, 0x0000, 0x0002, 0x0841, 0x10a2, 
+  0x800d, 0x0000, 0x0001, 0x1082, 0x800c, 0x0000, 0x0002, 0x0020, 
+  0x0020, 0x8009, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8005, 
+  0x0000, 0x0005, 0x1082, 0xef9d, 0xffff, 0xd6da, 0x0020, 0x8004, 
+  0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 0x8004, 0x0000, 
+  0x0009, 0xad75, 0xffff, 0xffff, 0x31a6, 0x0000, 0x31a6, 0xffff, 
+  0xffff, 0x6b6d, 0x8008, 0x0000, 0x0004, 0x94b2, 0xffff, 0xffff, 
+  0x4a69, 0x8006, 0x0000, 0x0004, 0x2104, 0xffff, 0xffff, 0xbe17, 
+  0x8004, 0x0000, 0x0008, 0x4a49, 0xad75, 0xef7d, 0xffff, 0xffff, 
+  0xe73c, 0xb5b6, 0x528a, 0x8008, 0x0000, 0x0006, 0x7bef, 0xd6ba, 
+  0xffff, 0xef9d, 0xbdf7, 0x3186, 0x8005, 0x0000, 0x0009, 0x39e7, 
+  0x8c71, 0xc658, 0xe75c, 0xffff, 0xf7de, 0xdefb, 0x8c91, 0x0861, 
+  0x8006, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8006, 0x0000, 
+  0x0004, 0x94d2, 0xffff, 0xffff, 0x632c, 0x8004, 0x0000, 0x0004, 
+  0x73ce, 0xffff, 0xffff, 0x31a6, 0x8004, 0x0000, 0x0009, 0x738e, 
+  0xffff, 0xffff, 0x5aeb, 0x0000, 0x4a69, 0xffff, 0xffff, 0x634c, 
+  0x8008, 0x0000, 0x0004, 0xdf1b, 0xffff, 0xf7be, 0x0841, 0x8007, 
+  0x0000, 0x0008, 0xd6ba, 0xffff, 0xffff, 0x0861, 0x0000, 0x0000, 
+  0x0000, 0xad75, 0x8006, 0xffff, 0x0002, 0xf7de, 0x73ce, 0x8006, 
+  0x0000, 0x0001, 0xa534, 0x8005, 0xffff, 0x0002, 0xe75c, 0x2985, 
+  0x8004, 0x0000, 0x0001, 0xa534, 0x8007, 0xffff, 0x0002, 0xdefb, 
+  0x0861, 0x8005, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8006, 
+  0x0000, 0x0004, 0x31a6, 0xffff, 0xffff, 0xad75, 0x8004, 0x0000, 
+  0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 0x8004, 0x0000, 0x0009, 
+  0x528a, 0xffff, 0xffff, 0x8410, 0x0000, 0x2104, 0xffff, 0xffff, 
+  0x9d13, 0x8008, 0x0000, 0x0003, 0xf7de, 0xffff, 0xc658, 0x8008, 
+  0x0000, 0x0011, 0x9cf3, 0xffff, 0xffff, 0x2945, 0x0000, 0x0000, 
+  0x0000, 0xad75, 0xffff, 0xe75c, 0x39c7, 0x2965, 0x5aeb, 0xdefb, 
+  0xffff, 0xffff, 0x4a89, 0x8004, 0x0000, 0x0009, 0x52ca, 0xffff, 
+  0xffff, 0x8c91, 0x2104, 0x4a69, 0xef9d, 0xffff, 0xb5b6, 0x8004, 
+  0x0000, 0x000a, 0xa534, 0xffff, 0xef9d, 0x632c, 0x4208, 0x4a89, 
+  0xb596, 0xffff, 0xffff, 0x7bef, 0x8005, 0x0000, 0x0003, 0xffff, 
+  0xffff, 0xad75, 0x8006, 0x0000, 0x0004, 0x0020, 0xffff, 0xffff, 
+  0xdf1b, 0x8004, 0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 
+  0x8004, 0x0000, 0x000a, 0x6b4d, 0xffff, 0xffff, 0x634c, 0x0000, 
+  0x0000, 0xe73c, 0xffff, 0xf7de, 0x39e7, 0x8006, 0x0000, 0x0004, 
+  0x18c3, 0xffff, 0xffff, 0xb5b6, 0x8008, 0x0000, 0x0011, 0x8c71, 
+  0xffff, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 
+  0xdf1b, 0x0000, 0x0000, 0x0000, 0x18e3, 0xef7d, 0xffff, 0xb5d6, 
+  0x8004, 0x0000, 0x0010, 0xbe17, 0xffff, 0xce79, 0x0000, 0x0000, 
+  0x0000, 0x8430, 0xffff, 0xf7de, 0x1082, 0x0000, 0x0000, 0x0000, 
+  0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0003, 0xce79, 0xffff, 
+  0xe75c, 0x8005, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8007, 
+  0x0000, 0x0003, 0xe75c, 0xffff, 0xffff, 0x8004, 0x0000, 0x0004, 
+  0x73ce, 0xffff, 0xffff, 0x31a6, 0x8004, 0x0000, 0x000b, 0x94d2, 
+  0xffff, 0xffff, 0x39e7, 0x0000, 0x0000, 0x5aeb, 0xffff, 0xffff, 
+  0xef9d, 0x4a89, 0x8005, 0x0000, 0x0004, 0x3186, 0xffff, 0xffff, 
+  0x9d13, 0x8008, 0x0000, 0x000a, 0x7bcf, 0xffff, 0xffff, 0x5acb, 
+  0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xdf1b, 0x8004, 0x0000, 
+  0x0017, 0x9d13, 0xffff, 0xffff, 0x2104, 0x0000, 0x0000, 0x2104, 
+  0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x4228, 0xffff, 
+  0xffff, 0x52aa, 0x0000, 0x0000, 0x0000, 0xa534, 0xffff, 0xe75c, 
+  0x8004, 0x0000, 0x0004, 0x7bef, 0xffff, 0xffff, 0x0861, 0x8004, 
+  0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8007, 0x0000, 0x0023, 
+  0xd6ba, 0xffff, 0xffff, 0x1082, 0x0000, 0x0000, 0x0000, 0x73ce, 
+  0xffff, 0xffff, 0x31a6, 0x0000, 0x0000, 0x0000, 0x2965, 0xf7be, 
+  0xffff, 0xf7de, 0x1082, 0x0000, 0x0000, 0x0000, 0x94d2, 0xffff, 
+  0xffff, 0xffff, 0x9cf3, 0x0861, 0x0000, 0x0000, 0x0000, 0x4a49, 
+  0xffff, 0xffff, 0x8c91, 0x8008, 0x0000, 0x000a, 0x6b4d, 0xffff, 
+  0xffff, 0x6b6d, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xdf1b, 
+  0x8004, 0x0000, 0x0017, 0x52aa, 0xffff, 0xffff, 0x4a69, 0x0000, 
+  0x0000, 0x4208, 0xffff, 0xffff, 0x4a49, 0x0000, 0x0000, 0x0000, 
+  0x2144, 0xffff, 0xffff, 0x6b6d, 0x0000, 0x0000, 0x0000, 0xa534, 
+  0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x5aeb, 0xffff, 0xffff, 
+  0x2965, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8007, 
+  0x0000, 0x0012, 0xbe17, 0xffff, 0xffff, 0x18e3, 0x0000, 0x0000, 
+  0x0000, 0x73ce, 0xffff, 0xffff, 0x4228, 0x18c3, 0x31c6, 0x7bef, 
+  0xef7d, 0xffff, 0xffff, 0x7bef, 0x8005, 0x0000, 0x000c, 0x7bef, 
+  0xf7de, 0xffff, 0xffff, 0xdefb, 0x3186, 0x0000, 0x0000, 0x39c7, 
+  0xffff, 0xffff, 0x9cf3, 0x8008, 0x0000, 0x000a, 0x73ae, 0xffff, 
+  0xffff, 0x5b0b, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xdf1b, 
+  0x8004, 0x0000, 0x0017, 0x3a07, 0xffff, 0xffff, 0x632c, 0x0000, 
+  0x0000, 0x5acb, 0xffff, 0xffff, 0x5acb, 0x31a6, 0x31a6, 0x31a6, 
+  0x4a49, 0xffff, 0xffff, 0x8410, 0x0000, 0x0000, 0x0000, 0xa534, 
+  0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4a49, 0xffff, 0xffff, 
+  0x4248, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8007, 
+  0x0000, 0x0008, 0xce99, 0xffff, 0xffff, 0x1082, 0x0000, 0x0000, 
+  0x0000, 0x73ce, 0x8008, 0xffff, 0x0001, 0xbdf7, 0x8007, 0x0000, 
+  0x000b, 0x39c7, 0xdefb, 0xffff, 0xffff, 0xef7d, 0x39c7, 0x0000, 
+  0x2104, 0xffff, 0xffff, 0xad75, 0x8008, 0x0000, 0x000a, 0x8450, 
+  0xffff, 0xffff, 0x4228, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 
+  0xdf1b, 0x8004, 0x0000, 0x0007, 0x2965, 0xffff, 0xffff, 0x7bef, 
+  0x0000, 0x0000, 0x738e, 0x8009, 0xffff, 0x0007, 0x94b2, 0x0000, 
+  0x0000, 0x0000, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 
+  0x4228, 0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 
+  0xffff, 0xad75, 0x8007, 0x0000, 0x0008, 0xe73c, 0xffff, 0xffff, 
+  0x0020, 0x0000, 0x0000, 0x0000, 0x73ce, 0x8006, 0xffff, 0x0002, 
+  0xd69a, 0x52aa, 0x8009, 0x0000, 0x000a, 0x0861, 0xb5b6, 0xffff, 
+  0xffff, 0xd6da, 0x0020, 0x0020, 0xffff, 0xffff, 0xbe17, 0x8008, 
+  0x0000, 0x000a, 0x94d2, 0xffff, 0xffff, 0x2965, 0x0000, 0x0000, 
+  0x0000, 0xad75, 0xffff, 0xdf1b, 0x8004, 0x0000, 0x000a, 0x2124, 
+  0xffff, 0xffff, 0x8430, 0x0000, 0x0000, 0x7bef, 0xffff, 0xffff, 
+  0xe73c, 0x8006, 0xdf1b, 0x0007, 0x8430, 0x0000, 0x0000, 0x0000, 
+  0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4228, 0xffff, 
+  0xffff, 0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 
+  0x8007, 0x0000, 0x0003, 0xf7de, 0xffff, 0xe75c, 0x8004, 0x0000, 
+  0x0007, 0x73ce, 0xffff, 0xffff, 0x6b8d, 0x4228, 0x2144, 0x0841, 
+  0x800c, 0x0000, 0x0009, 0x0020, 0xce59, 0xffff, 0xffff, 0x632c, 
+  0x0000, 0xe75c, 0xffff, 0xe75c, 0x8008, 0x0000, 0x000a, 0xc618, 
+  0xffff, 0xffff, 0x10a2, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 
+  0xdf1b, 0x8004, 0x0000, 0x000a, 0x39c7, 0xffff, 0xffff, 0x6b8d, 
+  0x0000, 0x0000, 0x634c, 0xffff, 0xffff, 0x2945, 0x800a, 0x0000, 
+  0x0003, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4228, 
+  0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 
+  0xad75, 0x8006, 0x0000, 0x0004, 0x2124, 0xffff, 0xffff, 0xb5b6, 
+  0x8004, 0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 0x8010, 
+  0x0000, 0x0009, 0x4248, 0xffff, 0xffff, 0x9cd3, 0x0000, 0xad75, 
+  0xffff, 0xffff, 0x39e7, 0x8006, 0x0000, 0x0004, 0x1082, 0xf7de, 
+  0xffff, 0xd6ba, 0x8004, 0x0000, 0x0003, 0xad75, 0xffff, 0xdf1b, 
+  0x8004, 0x0000, 0x000a, 0x4a69, 0xffff, 0xffff, 0x5acb, 0x0000, 
+  0x0000, 0x4a89, 0xffff, 0xffff, 0x4228, 0x800a, 0x0000, 0x0003, 
+  0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4228, 0xffff, 
+  0xffff, 0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 
+  0x8006, 0x0000, 0x0004, 0x8430, 0xffff, 0xffff, 0x73ce, 0x8004, 
+  0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 0x8010, 0x0000, 
+  0x0009, 0x1082, 0xffff, 0xffff, 0xbe17, 0x0000, 0x4248, 0xffff, 
+  0xffff, 0x8c71, 0x8006, 0x0000, 0x0004, 0x5aeb, 0xffff, 0xffff, 
+  0x738e, 0x8004, 0x0000, 0x0003, 0xad75, 0xffff, 0xdf1b, 0x8004, 
+  0x0000, 0x000a, 0x7c0f, 0xffff, 0xffff, 0x4208, 0x0000, 0x0000, 
+  0x3186, 0xffff, 0xffff, 0x7bef, 0x800a, 0x0000, 0x0003, 0xa534, 
+  0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4228, 0xffff, 0xffff, 
+  0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 0xffff, 0xad75, 0x8005, 
+  0x0000, 0x0005, 0x0020, 0xe73c, 0xffff, 0xe75c, 0x0861, 0x8004, 
+  0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 0x8010, 0x0000, 
+  0x000a, 0x18e3, 0xffff, 0xffff, 0xa554, 0x0000, 0x0000, 0xdefb, 
+  0xffff, 0xf7be, 0x39e7, 0x8004, 0x0000, 0x0005, 0x18e3, 0xe75c, 
+  0xffff, 0xf7be, 0x10a2, 0x8004, 0x0000, 0x0003, 0xad75, 0xffff, 
+  0xdf1b, 0x8004, 0x0000, 0x000b, 0xd6ba, 0xffff, 0xe75c, 0x0020, 
+  0x0000, 0x0000, 0x0000, 0xd6ba, 0xffff, 0xd6da, 0x0841, 0x8009, 
+  0x0000, 0x0003, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 
+  0x4228, 0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x0003, 0xffff, 
+  0xffff, 0xad75, 0x8004, 0x0000, 0x0005, 0x10a2, 0xbdf7, 0xffff, 
+  0xffff, 0x6b8d, 0x8005, 0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 
+  0x31a6, 0x8010, 0x0000, 0x0012, 0x6b6d, 0xffff, 0xffff, 0x7c0f, 
+  0x0000, 0x0000, 0x632c, 0xffff, 0xffff, 0xe73c, 0x630c, 0x18c3, 
+  0x0861, 0x52aa, 0xce99, 0xffff, 0xffff, 0x8c91, 0x8005, 0x0000, 
+  0x000a, 0xad75, 0xffff, 0xe75c, 0x31a6, 0x0000, 0x1082, 0x9cf3, 
+  0xffff, 0xffff, 0x94b2, 0x8004, 0x0000, 0x0009, 0x73ae, 0xffff, 
+  0xffff, 0xb5d6, 0x2144, 0x0000, 0x0020, 0x39c7, 0x39c7, 0x8004, 
+  0x0000, 0x0003, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 
+  0x4228, 0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x000c, 0xffff, 
+  0xffff, 0xc638, 0x39c7, 0x31c6, 0x5aeb, 0x8450, 0xdf1b, 0xffff, 
+  0xffff, 0xd6da, 0x0020, 0x8005, 0x0000, 0x0004, 0x73ce, 0xffff, 
+  0xffff, 0x31a6, 0x8009, 0x0000, 0x0018, 0x10a2, 0xad95, 0x39e7, 
+  0x0020, 0x0000, 0x0020, 0x5aeb, 0xef9d, 0xffff, 0xef9d, 0x18e3, 
+  0x0000, 0x0000, 0x0000, 0x6b4d, 0xf7de, 0xffff, 0xffff, 0xf7de, 
+  0xf7de, 0xffff, 0xffff, 0xffff, 0x94b2, 0x8006, 0x0000, 0x000a, 
+  0xad75, 0xffff, 0xffff, 0xffff, 0xef9d, 0xf7de, 0xffff, 0xffff, 
+  0xdf1b, 0x2104, 0x8004, 0x0000, 0x0009, 0x0841, 0xbdd7, 0xffff, 
+  0xffff, 0xffff, 0xef7d, 0xf7de, 0xffff, 0x9cf3, 0x8004, 0x0000, 
+  0x0003, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 0x0004, 0x4228, 
+  0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x8009, 0xffff, 0x0002, 
+  0x9cf3, 0x1082, 0x8006, 0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 
+  0x31a6, 0x8009, 0x0000, 0x000a, 0x738e, 0xffff, 0xffff, 0xf7de, 
+  0xdf1b, 0xf7de, 0xffff, 0xffff, 0xffff, 0x6b6d, 0x8005, 0x0000, 
+  0x0008, 0x5aeb, 0xce99, 0xf7de, 0xffff, 0xffff, 0xffff, 0xdefb, 
+  0x7bef, 0x8007, 0x0000, 0x0009, 0xad75, 0xffff, 0xf7de, 0xf7de, 
+  0xffff, 0xffff, 0xffff, 0xd69a, 0x2104, 0x8006, 0x0000, 0x0008, 
+  0x0020, 0x9d13, 0xef9d, 0xffff, 0xffff, 0xffff, 0xf7de, 0x8c71, 
+  0x8004, 0x0000, 0x0003, 0xa534, 0xffff, 0xe75c, 0x8004, 0x0000, 
+  0x0004, 0x4228, 0xffff, 0xffff, 0x4a49, 0x8004, 0x0000, 0x0009, 
+  0xb5d6, 0xd6da, 0xf7be, 0xffff, 0xffff, 0xf7de, 0xd6da, 0xb596, 
+  0x4228, 0x8008, 0x0000, 0x0004, 0x73ce, 0xffff, 0xffff, 0x31a6, 
+  0x8009, 0x0000, 0x0002, 0x4a69, 0xce79, 0x8005, 0xffff, 0x0002, 
+  0xdefb, 0x4228, 0x8008, 0x0000, 0x0004, 0x1082, 0x4a69, 0x52aa, 
+  0x18e3, 0x8009, 0x0000, 0x0007, 0xad75, 0xffff, 0xdf1b, 0x18c3, 
+  0x4a89, 0x4a69, 0x18c3, 0x800b, 0x0000, 0x0004, 0x3186, 0x52aa, 
+  0x39c7, 0x1082, 0x8017, 0x0000, 0x0003, 0x18c3, 0x2945, 0x0020, 
+  0x801a, 0x0000, 0x0005, 0x2124, 0x4a49, 0x632c, 0x4a69, 0x2104, 
+  0x8017, 0x0000, 0x0003, 0xad75, 0xffff, 0xdf1b, 0x8063, 0x0000, 
+  0x0003, 0xad75, 0xffff, 0xdf1b, 0x8063, 0x0000, 0x0003, 0xad75, 
+  0xffff, 0xdf1b, 0x8063, 0x0000, 0x0003, 0xad75, 0xffff, 0xdf1b, 
+  0x8063, 0x0000, 0x0003, 0x5aeb, 0x8c51, 0x7bcf, 0x80b6, 0x0000
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+/** Gfx generated from `./gen_lookup.py -i gfx/png/logo.png -o logo` */
+
+#ifndef __GFX_LOGO_H__
+#define __GFX_LOGO_H__
+
+#include <stdint.h>
+
+#define GFX_LOGO_HEIGHT (29)
+#define GFX_LOGO_WIDTH  (102)
+
+extern const uint16_t gfx_logo[1592];
+
+#endif // __GFX_LOGO_H__
\ No newline at end of file
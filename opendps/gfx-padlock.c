@@ -2,29 +2,17 @@
 
 #include "gfx-padlock.h"
 
-const uint8_t gfx_padlock[384] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42, 0x28, 0x9c, 0xf3, 0x9c, 0xf3, 0x42, 0x28, 
-  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0xbe, 0x17, 
-  0xff, 0xff, 0xf7, 0xbe, 0xf7, 0xbe, 0xff, 0xff, 0xbe, 0x17, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x82, 0xce, 0x99, 0xef, 0x7d, 0x63, 0x0c, 0x18, 0xe3, 0x18, 0xe3, 0x63, 0x0c, 
-  0xef, 0x7d, 0xce, 0x99, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0xff, 0xff, 0x52, 0x8a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x8a, 0xff, 0xff, 0x6b, 0x6d, 0x00, 0x00, 
-  0x00, 0x00, 0xad, 0x75, 0xdf, 0x1b, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x20, 0xdf, 0x1b, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd6, 0xd6, 0xba, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xba, 0xb5, 0xd6, 0x00, 0x00, 
-  0x00, 0x00, 0xb5, 0xb6, 0xd6, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xd6, 0xba, 0xb5, 0xb6, 0x00, 0x00, 0xb5, 0xd6, 0xe7, 0x5c, 0xef, 0x9d, 0xb5, 0xd6, 
-  0xb5, 0xd6, 0xb5, 0xd6, 0xb5, 0xd6, 0xb5, 0xd6, 0xb5, 0xd6, 0xef, 0x9d, 0xe7, 0x5c, 0xb5, 0xd6, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_padlock[86] = {
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x9cf3, 0x9cf3, 
+  0x4228, 0x0020, 0x8005, 0x0000, 0x001a, 0x2124, 0xbe17, 0xffff, 
+  0xf7be, 0xf7be, 0xffff, 0xbe17, 0x2124, 0x0000, 0x0000, 0x0000, 
+  0x1082, 0xce99, 0xef7d, 0x630c, 0x18e3, 0x18e3, 0x630c, 0xef7d, 
+  0xce99, 0x1082, 0x0000, 0x0000, 0x6b6d, 0xffff, 0x528a, 0x8004, 
+  0x0000, 0x0008, 0x528a, 0xffff, 0x6b6d, 0x0000, 0x0000, 0xad75, 
+  0xdf1b, 0x0020, 0x8004, 0x0000, 0x0007, 0x0020, 0xdf1b, 0xad75, 
+  0x0000, 0x0000, 0xb5d6, 0xd6ba, 0x8006, 0x0000, 0x0006, 0xd6ba, 
+  0xb5d6, 0x0000, 0x0000, 0xb5b6, 0xd6ba, 0x8006, 0x0000, 0x0006, 
+  0xd6ba, 0xb5b6, 0x0000, 0xb5d6, 0xe75c, 0xef9d, 0x8006, 0xb5d6, 
+  0x0003, 0xef9d, 0xe75c, 0xb5d6, 0x8060, 0xffff
 };
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_PADLOCK_HEIGHT (16)
 #define GFX_PADLOCK_WIDTH  (12)
 
-extern const uint8_t gfx_padlock[384];
+extern const uint16_t gfx_padlock[86];
 
 #endif // __GFX_PADLOCK_H__
\ No newline at end of file
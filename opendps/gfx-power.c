@@ -2,37 +2,31 @@
 
 #include "gfx-power.h"
 
-const uint8_t gfx_power[512] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x4c, 
-  0x63, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xf7, 0xbe, 
-  0xef, 0x9d, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0xf7, 0xbe, 
-  0xef, 0x9d, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0x89, 0xd6, 0xda, 0x8c, 0x71, 0x00, 0x00, 0x21, 0x04, 0xf7, 0xbe, 
-  0xef, 0x9d, 0x18, 0xe3, 0x00, 0x00, 0x8c, 0x91, 0xd6, 0xda, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x31, 0xa6, 0xef, 0x9d, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x21, 0x04, 0xf7, 0xbe, 
-  0xef, 0x9d, 0x18, 0xe3, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xef, 0x7d, 0x31, 0x86, 0x00, 0x00, 
-  0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xad, 0x75, 0x08, 0x41, 0x00, 0x00, 0x21, 0x04, 0xf7, 0xbe, 
-  0xef, 0x9d, 0x18, 0xe3, 0x00, 0x00, 0x08, 0x41, 0xb5, 0x96, 0xff, 0xff, 0xb5, 0xd6, 0x00, 0x00, 
-  0x31, 0xa6, 0xf7, 0xde, 0xef, 0x7d, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xf7, 0xde, 
-  0xf7, 0xbe, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xef, 0x9d, 0xf7, 0xde, 0x31, 0x86, 
-  0x7b, 0xcf, 0xff, 0xff, 0xb5, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xcb, 
-  0x52, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0x63, 0x4c, 
-  0xdf, 0x1b, 0xff, 0xff, 0x9c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0x84, 0x30, 
-  0x7b, 0xcf, 0xff, 0xff, 0xb5, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0x63, 0x4c, 
-  0x31, 0xa6, 0xf7, 0xde, 0xef, 0x7d, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xef, 0x9d, 0xf7, 0xde, 0x31, 0x86, 
-  0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xad, 0x75, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb5, 0xb6, 0xff, 0xff, 0xb5, 0xd6, 0x00, 0x00, 
-  0x00, 0x00, 0x31, 0xa6, 0xef, 0x7d, 0xff, 0xff, 0xad, 0x75, 0x21, 0x44, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xb5, 0x96, 0xff, 0xff, 0xef, 0x7d, 0x31, 0x86, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0x69, 0xe7, 0x5c, 0xff, 0xff, 0xef, 0x9d, 0xad, 0x75, 0x84, 0x30, 
-  0x84, 0x30, 0xad, 0x95, 0xef, 0x9d, 0xff, 0xff, 0xe7, 0x5c, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 0xa5, 0x54, 0xef, 0x9d, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xef, 0x9d, 0xa5, 0x34, 0x29, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x5a, 0xcb, 0x94, 0xb2, 
-  0x94, 0xb2, 0x5a, 0xcb, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_power[198] = {
+  0x8007, 0x0000, 0x0002, 0x634c, 0x632c, 0x800d, 0x0000, 0x0004, 
+  0x18e3, 0xf7be, 0xef9d, 0x18c3, 0x8009, 0x0000, 0x000a, 0x0841, 
+  0x0000, 0x0000, 0x2104, 0xf7be, 0xef9d, 0x18e3, 0x0000, 0x0000, 
+  0x0841, 0x8005, 0x0000, 0x0041, 0x4a89, 0xd6da, 0x8c71, 0x0000, 
+  0x2104, 0xf7be, 0xef9d, 0x18e3, 0x0000, 0x8c91, 0xd6da, 0x4a69, 
+  0x0000, 0x0000, 0x0000, 0x31a6, 0xef9d, 0xffff, 0x94b2, 0x0000, 
+  0x2104, 0xf7be, 0xef9d, 0x18e3, 0x0000, 0x9cd3, 0xffff, 0xef7d, 
+  0x3186, 0x0000, 0x0020, 0xbdf7, 0xffff, 0xad75, 0x0841, 0x0000, 
+  0x2104, 0xf7be, 0xef9d, 0x18e3, 0x0000, 0x0841, 0xb596, 0xffff, 
+  0xb5d6, 0x0000, 0x31a6, 0xf7de, 0xef7d, 0x2124, 0x0000, 0x0000, 
+  0x18e3, 0xf7de, 0xf7be, 0x18c3, 0x0000, 0x0000, 0x2945, 0xef9d, 
+  0xf7de, 0x3186, 0x7bcf, 0xffff, 0xb5d6, 0x8004, 0x0000, 0x0002, 
+  0x5acb, 0x52aa, 0x8004, 0x0000, 0x0006, 0xbdf7, 0xffff, 0x634c, 
+  0xdf1b, 0xffff, 0x9cf3, 0x800a, 0x0000, 0x0006, 0xa534, 0xffff, 
+  0x8430, 0x7bcf, 0xffff, 0xb5d6, 0x800a, 0x0000, 0x0007, 0xbdf7, 
+  0xffff, 0x634c, 0x31a6, 0xf7de, 0xef7d, 0x2124, 0x8008, 0x0000, 
+  0x0009, 0x2945, 0xef9d, 0xf7de, 0x3186, 0x0020, 0xbdf7, 0xffff, 
+  0xad75, 0x0020, 0x8006, 0x0000, 0x000b, 0x0020, 0xb5b6, 0xffff, 
+  0xb5d6, 0x0000, 0x0000, 0x31a6, 0xef7d, 0xffff, 0xad75, 0x2144, 
+  0x8004, 0x0000, 0x0014, 0x2945, 0xb596, 0xffff, 0xef7d, 0x3186, 
+  0x0000, 0x0000, 0x0000, 0x4a69, 0xe75c, 0xffff, 0xef9d, 0xad75, 
+  0x8430, 0x8430, 0xad95, 0xef9d, 0xffff, 0xe75c, 0x4a49, 0x8005, 
+  0x0000, 0x0003, 0x2965, 0xa554, 0xef9d, 0x8004, 0xffff, 0x0003, 
+  0xef9d, 0xa534, 0x2945, 0x8008, 0x0000, 0x0006, 0x2124, 0x5acb, 
+  0x94b2, 0x94b2, 0x5acb, 0x2124, 0x8005, 0x0000
 };
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_POWER_HEIGHT (16)
 #define GFX_POWER_WIDTH  (16)
 
-extern const uint8_t gfx_power[512];
+extern const uint16_t gfx_power[198];
 
 #endif // __GFX_POWER_H__
\ No newline at end of file
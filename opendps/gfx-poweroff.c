@@ -2,37 +2,35 @@
 
 #include "gfx-poweroff.h"
 
-const uint8_t gfx_poweroff[512] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 
-  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d, 
-  0x00, 0x1d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d, 
-  0x00, 0x1d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d, 
-  0x00, 0x1d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d, 
-  0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x06, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x00, 
-  0x00, 0x06, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x06, 
-  0x00, 0x0c, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x0c, 
-  0x00, 0x10, 0x00, 0x1f, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-  0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x10, 
-  0x00, 0x0c, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x0c, 
-  0x00, 0x06, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x06, 
-  0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x06, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x15, 0x00, 0x10, 
-  0x00, 0x10, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x05, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x1f, 
-  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x12, 
-  0x00, 0x12, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_poweroff[228] = {
+  0x8007, 0x0000, 0x0002, 0x000c, 0x000c, 0x8006, 0x0000, 0x0001, 
+  0x001f, 0x8006, 0x0000, 0x0004, 0x0003, 0x001d, 0x001d, 0x0003, 
+  0x8004, 0x0000, 0x0055, 0x001f, 0x001f, 0x0000, 0x0000, 0x0000, 
+  0x0001, 0x0000, 0x0000, 0x0003, 0x001d, 0x001d, 0x0003, 0x0000, 
+  0x0000, 0x0000, 0x001f, 0x001f, 0x0000, 0x0000, 0x0000, 0x0009, 
+  0x001a, 0x0011, 0x0000, 0x0003, 0x001d, 0x001d, 0x0003, 0x0000, 
+  0x0000, 0x001f, 0x001f, 0x0000, 0x0000, 0x0000, 0x0006, 0x001d, 
+  0x001f, 0x0013, 0x0000, 0x0003, 0x001d, 0x001d, 0x0000, 0x0000, 
+  0x001f, 0x001f, 0x001d, 0x0006, 0x0000, 0x0000, 0x0016, 0x001f, 
+  0x0016, 0x0001, 0x0000, 0x0003, 0x001d, 0x0000, 0x0000, 0x001f, 
+  0x001f, 0x0016, 0x001f, 0x0016, 0x0000, 0x0006, 0x001e, 0x001d, 
+  0x0005, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x001f, 0x001f, 
+  0x0000, 0x0005, 0x001d, 0x001e, 0x0006, 0x000c, 0x001f, 0x0017, 
+  0x8005, 0x0000, 0x000b, 0x001f, 0x001f, 0x0000, 0x0000, 0x0000, 
+  0x0017, 0x001f, 0x000c, 0x0010, 0x001f, 0x0014, 0x8004, 0x0000, 
+  0x0002, 0x001f, 0x001f, 0x8004, 0x0000, 0x000b, 0x0014, 0x001f, 
+  0x0010, 0x000c, 0x001f, 0x0017, 0x0000, 0x0000, 0x0000, 0x001f, 
+  0x001f, 0x8005, 0x0000, 0x000a, 0x0017, 0x001f, 0x000c, 0x0006, 
+  0x001e, 0x001d, 0x0000, 0x0000, 0x001f, 0x001f, 0x8005, 0x0000, 
+  0x000a, 0x0005, 0x001d, 0x001e, 0x0006, 0x0000, 0x0016, 0x0000, 
+  0x0000, 0x001f, 0x001f, 0x8006, 0x0000, 0x0003, 0x0016, 0x001f, 
+  0x0016, 0x8004, 0x0000, 0x0003, 0x001f, 0x001f, 0x0005, 0x8004, 
+  0x0000, 0x001c, 0x0005, 0x0016, 0x001f, 0x001d, 0x0006, 0x0000, 
+  0x0000, 0x0000, 0x001f, 0x001f, 0x001f, 0x001d, 0x0015, 0x0010, 
+  0x0010, 0x0015, 0x001d, 0x001f, 0x001c, 0x0009, 0x0000, 0x0000, 
+  0x0000, 0x001f, 0x001f, 0x0005, 0x0014, 0x001d, 0x8004, 0x001f, 
+  0x0011, 0x001d, 0x0014, 0x0005, 0x0000, 0x0000, 0x0000, 0x001f, 
+  0x001f, 0x0000, 0x0000, 0x0000, 0x0004, 0x000b, 0x0012, 0x0012, 
+  0x000b, 0x0004, 0x8005, 0x0000
 };
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_POWEROFF_HEIGHT (16)
 #define GFX_POWEROFF_WIDTH  (16)
 
-extern const uint8_t gfx_poweroff[512];
+extern const uint16_t gfx_poweroff[228];
 
 #endif // __GFX_POWEROFF_H__
\ No newline at end of file
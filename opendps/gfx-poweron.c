@@ -2,37 +2,31 @@
 
 #include "gfx-poweron.h"
 
-const uint8_t gfx_poweron[512] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 
-  0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x80, 
-  0x07, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x80, 
-  0x07, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x06, 0xc0, 0x04, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x80, 
-  0x07, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x04, 0x80, 0x06, 0xc0, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x80, 0x07, 0x60, 0x07, 0xe0, 0x04, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x80, 
-  0x07, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x04, 0xc0, 0x07, 0xe0, 0x07, 0x60, 0x01, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x05, 0xc0, 0x07, 0xe0, 0x05, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x80, 
-  0x07, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x40, 0x05, 0x80, 0x07, 0xe0, 0x05, 0xc0, 0x00, 0x00, 
-  0x01, 0x80, 0x07, 0xc0, 0x07, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0xa0, 
-  0x07, 0xa0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0x80, 0x07, 0xc0, 0x01, 0x80, 
-  0x03, 0x40, 0x07, 0xe0, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 
-  0x02, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe0, 0x07, 0xe0, 0x03, 0x40, 
-  0x04, 0x20, 0x07, 0xe0, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x07, 0xe0, 0x04, 0x20, 
-  0x03, 0x40, 0x07, 0xe0, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe0, 0x07, 0xe0, 0x03, 0x40, 
-  0x01, 0x80, 0x07, 0xc0, 0x07, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0x80, 0x07, 0xc0, 0x01, 0x80, 
-  0x00, 0x00, 0x05, 0xc0, 0x07, 0xe0, 0x05, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0xa0, 0x07, 0xe0, 0x05, 0xc0, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x80, 0x07, 0x60, 0x07, 0xe0, 0x05, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x80, 0x07, 0xe0, 0x07, 0x60, 0x01, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x07, 0x40, 0x07, 0xe0, 0x07, 0x80, 0x05, 0x80, 0x04, 0x20, 
-  0x04, 0x20, 0x05, 0x80, 0x07, 0x80, 0x07, 0xe0, 0x07, 0x40, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x20, 0x07, 0x80, 0x07, 0xe0, 0x07, 0xe0, 
-  0x07, 0xe0, 0x07, 0xe0, 0x07, 0x80, 0x05, 0x20, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0xc0, 0x04, 0xa0, 
-  0x04, 0xa0, 0x02, 0xc0, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_poweron[198] = {
+  0x8007, 0x0000, 0x0002, 0x0320, 0x0320, 0x800d, 0x0000, 0x0004, 
+  0x00c0, 0x0780, 0x0780, 0x00c0, 0x8009, 0x0000, 0x000a, 0x0040, 
+  0x0000, 0x0000, 0x00e0, 0x0780, 0x0780, 0x00e0, 0x0000, 0x0000, 
+  0x0040, 0x8005, 0x0000, 0x0041, 0x0260, 0x06c0, 0x0480, 0x0000, 
+  0x00e0, 0x0780, 0x0780, 0x00e0, 0x0000, 0x0480, 0x06c0, 0x0260, 
+  0x0000, 0x0000, 0x0000, 0x0180, 0x0760, 0x07e0, 0x04c0, 0x0000, 
+  0x00e0, 0x0780, 0x0780, 0x00e0, 0x0000, 0x04c0, 0x07e0, 0x0760, 
+  0x0180, 0x0000, 0x0000, 0x05c0, 0x07e0, 0x0580, 0x0040, 0x0000, 
+  0x00e0, 0x0780, 0x0780, 0x00e0, 0x0000, 0x0040, 0x0580, 0x07e0, 
+  0x05c0, 0x0000, 0x0180, 0x07c0, 0x0780, 0x0140, 0x0000, 0x0000, 
+  0x00c0, 0x07a0, 0x07a0, 0x00c0, 0x0000, 0x0000, 0x0140, 0x0780, 
+  0x07c0, 0x0180, 0x0340, 0x07e0, 0x05e0, 0x8004, 0x0000, 0x0002, 
+  0x02a0, 0x02a0, 0x8004, 0x0000, 0x0006, 0x05e0, 0x07e0, 0x0340, 
+  0x0420, 0x07e0, 0x0520, 0x800a, 0x0000, 0x0006, 0x0520, 0x07e0, 
+  0x0420, 0x0340, 0x07e0, 0x05e0, 0x800a, 0x0000, 0x0007, 0x05e0, 
+  0x07e0, 0x0340, 0x0180, 0x07c0, 0x0780, 0x0140, 0x8008, 0x0000, 
+  0x0009, 0x0140, 0x0780, 0x07c0, 0x0180, 0x0000, 0x05c0, 0x07e0, 
+  0x05a0, 0x0020, 0x8006, 0x0000, 0x000b, 0x0020, 0x05a0, 0x07e0, 
+  0x05c0, 0x0000, 0x0000, 0x0180, 0x0760, 0x07e0, 0x0580, 0x0140, 
+  0x8004, 0x0000, 0x0014, 0x0140, 0x0580, 0x07e0, 0x0760, 0x0180, 
+  0x0000, 0x0000, 0x0000, 0x0240, 0x0740, 0x07e0, 0x0780, 0x0580, 
+  0x0420, 0x0420, 0x0580, 0x0780, 0x07e0, 0x0740, 0x0240, 0x8005, 
+  0x0000, 0x0003, 0x0140, 0x0520, 0x0780, 0x8004, 0x07e0, 0x0003, 
+  0x0780, 0x0520, 0x0140, 0x8008, 0x0000, 0x0006, 0x0120, 0x02c0, 
+  0x04a0, 0x04a0, 0x02c0, 0x0120, 0x8005, 0x0000
 };
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_POWERON_HEIGHT (16)
 #define GFX_POWERON_WIDTH  (16)
 
-extern const uint8_t gfx_poweron[512];
+extern const uint16_t gfx_poweron[198];
 
 #endif // __GFX_POWERON_H__
\ No newline at end of file
@@ -2,65 +2,30 @@
 
 #include "gfx-saw.h"
 
-const uint8_t gfx_saw[960] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x5a, 0xcb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4a, 0x89, 0xb5, 0xb6, 0xf7, 0xde, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xe3, 0x84, 0x10, 0xdf, 0x1b, 0xff, 0xff, 0xd6, 0xda, 0xe7, 0x3c, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x2c, 
-  0xc6, 0x58, 0xff, 0xff, 0xef, 0x9d, 0x94, 0xb2, 0x31, 0x86, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x8c, 0x71, 0xe7, 0x5c, 0xff, 0xff, 
-  0xce, 0x79, 0x63, 0x2c, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0x52, 0xaa, 0xb5, 0xd6, 0xf7, 0xde, 0xef, 0x9d, 0x94, 0xb2, 0x31, 0x86, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7b, 0xcf, 0xde, 0xfb, 0xff, 0xff, 0xd6, 0xda, 0x73, 0xce, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 
-  0xe7, 0x5c, 0xad, 0x55, 0x42, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x6b, 0x6d, 0xc6, 0x38, 0xef, 0x9d, 
-  0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0x61, 0x5a, 0xeb, 0xb5, 0xd6, 0xf7, 0xde, 0xff, 0xff, 0xd6, 0xba, 0x7b, 0xef, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x5a, 0xeb, 
-  0xb5, 0xd6, 0xf7, 0xde, 0xff, 0xff, 0xd6, 0xba, 0x7b, 0xef, 0x21, 0x44, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x52, 0xaa, 0xad, 0x95, 0xf7, 0xbe, 0xff, 0xff, 
-  0xe7, 0x3c, 0x84, 0x30, 0x29, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xbd, 0xf7, 
-  0x00, 0x00, 0x42, 0x08, 0x9d, 0x13, 0xe7, 0x5c, 0xff, 0xff, 0xef, 0x7d, 0x94, 0xb2, 0x39, 0xc7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xe7, 0x3c, 
-  0xd6, 0xba, 0xff, 0xff, 0xf7, 0xde, 0xb5, 0xb6, 0x5a, 0xeb, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xf7, 0xde, 
-  0xbe, 0x17, 0x6b, 0x4d, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x8a, 0x21, 0x04, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_saw[186] = {
+  0x800e, 0x0000, 0x0002, 0x2104, 0x5acb, 0x801b, 0x0000, 0x0005, 
+  0x0020, 0x4a89, 0xb5b6, 0xf7de, 0xbdf7, 0x8019, 0x0000, 0x0007, 
+  0x18e3, 0x8410, 0xdf1b, 0xffff, 0xd6da, 0xe73c, 0xbdf7, 0x8016, 
+  0x0000, 0x000a, 0x0841, 0x632c, 0xc658, 0xffff, 0xef9d, 0x94b2, 
+  0x3186, 0x0000, 0xbdf7, 0xbdf7, 0x8014, 0x0000, 0x000c, 0x2104, 
+  0x8c71, 0xe75c, 0xffff, 0xce79, 0x632c, 0x0861, 0x0000, 0x0000, 
+  0x0000, 0xbdf7, 0xbdf7, 0x8011, 0x0000, 0x0007, 0x0020, 0x52aa, 
+  0xb5d6, 0xf7de, 0xef9d, 0x94b2, 0x3186, 0x8006, 0x0000, 0x0002, 
+  0xbdf7, 0xbdf7, 0x8010, 0x0000, 0x0006, 0x7bcf, 0xdefb, 0xffff, 
+  0xd6da, 0x73ce, 0x10a2, 0x8008, 0x0000, 0x0002, 0xbdf7, 0xbdf7, 
+  0x800f, 0x0000, 0x0004, 0x10a2, 0xe75c, 0xad55, 0x4228, 0x800b, 
+  0x0000, 0x0002, 0xbdf7, 0xbdf7, 0x800c, 0x0000, 0x0005, 0x18c3, 
+  0x6b6d, 0xc638, 0xef9d, 0x0841, 0x800d, 0x0000, 0x0002, 0xbdf7, 
+  0xbdf7, 0x8009, 0x0000, 0x0007, 0x0861, 0x5aeb, 0xb5d6, 0xf7de, 
+  0xffff, 0xd6ba, 0x7bef, 0x800e, 0x0000, 0x0002, 0xbdf7, 0xbdf7, 
+  0x8006, 0x0000, 0x0008, 0x0861, 0x5aeb, 0xb5d6, 0xf7de, 0xffff, 
+  0xd6ba, 0x7bef, 0x2144, 0x8010, 0x0000, 0x000d, 0xbdf7, 0xbdf7, 
+  0x0000, 0x0000, 0x0000, 0x0020, 0x52aa, 0xad95, 0xf7be, 0xffff, 
+  0xe73c, 0x8430, 0x2945, 0x8013, 0x0000, 0x000a, 0xbdf7, 0xbdf7, 
+  0x0000, 0x4208, 0x9d13, 0xe75c, 0xffff, 0xef7d, 0x94b2, 0x39c7, 
+  0x8016, 0x0000, 0x0008, 0xbdf7, 0xe73c, 0xd6ba, 0xffff, 0xf7de, 
+  0xb5b6, 0x5aeb, 0x0861, 0x8018, 0x0000, 0x0005, 0xbdf7, 0xf7de, 
+  0xbe17, 0x6b4d, 0x10a2, 0x801b, 0x0000, 0x0002, 0x528a, 0x2104, 
+  0x8010, 0x0000
 };
\ No newline at end of file
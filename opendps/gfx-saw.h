@@ -8,6 +8,6 @@
 #define GFX_SAW_HEIGHT (15)
 #define GFX_SAW_WIDTH  (32)
 
-extern const uint8_t gfx_saw[960];
+extern const uint16_t gfx_saw[186];
 
 #endif // __GFX_SAW_H__
\ No newline at end of file
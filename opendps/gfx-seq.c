@@ -0,0 +1,32 @@
+/** Gfx generated from `./gen_lookup.py -i gfx/png/seq.png -o seq` */
+
+#include "gfx-seq.h"
+
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_seq[194] = {
+  0x8010, 0x0000, 0x0022, 0x18c3, 0x9cf3, 0xdf1b, 0xef7d, 0xbe17, 
+  0x3186, 0x0000, 0x0000, 0x0841, 0x8430, 0xdefb, 0xf7be, 0xd6da, 
+  0x73ce, 0x0000, 0x0000, 0xce99, 0xce79, 0x2124, 0x0841, 0x4a49, 
+  0x1082, 0x0000, 0x0000, 0xb5b6, 0xe73c, 0x39e7, 0x0841, 0x4a49, 
+  0xef7d, 0x9cf3, 0x0000, 0xffff, 0x5acb, 0x8005, 0x0000, 0x000b, 
+  0x528a, 0xffff, 0x52aa, 0x0000, 0x0000, 0x0000, 0x6b6d, 0xffff, 
+  0x39c7, 0xffff, 0x6b4d, 0x8005, 0x0000, 0x000c, 0xad55, 0xf7be, 
+  0x0020, 0x0000, 0x0000, 0x0000, 0x10a2, 0xffff, 0x8c91, 0xd6ba, 
+  0xdf1b, 0x18e3, 0x8004, 0x0000, 0x0002, 0xdefb, 0xd6ba, 0x8005, 
+  0x0000, 0x000b, 0xef9d, 0xbe17, 0x2124, 0xd6ba, 0xe73c, 0x52aa, 
+  0x0000, 0x0000, 0x0000, 0xef9d, 0xbe17, 0x8005, 0x0000, 0x000b, 
+  0xdefb, 0xd6ba, 0x0000, 0x0841, 0x8c71, 0xffff, 0x9cf3, 0x0000, 
+  0x0000, 0xef7d, 0xbe17, 0x8005, 0x0000, 0x000b, 0xdefb, 0xce99, 
+  0x0000, 0x0000, 0x0000, 0x7bef, 0xffff, 0x632c, 0x0000, 0xd69a, 
+  0xd6ba, 0x8005, 0x0000, 0x0041, 0xef9d, 0xb5d6, 0x0000, 0x0000, 
+  0x0000, 0x0020, 0xf7be, 0xad95, 0x0000, 0xad75, 0xf7be, 0x0020, 
+  0x0000, 0x0000, 0x0000, 0x10a2, 0xffff, 0x8c71, 0x0000, 0x0000, 
+  0x0000, 0x0020, 0xf7be, 0xa554, 0x0000, 0x5acb, 0xffff, 0x528a, 
+  0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x31a6, 0x5aeb, 0x10a2, 
+  0x1082, 0x8c91, 0xffff, 0x4228, 0x0000, 0x0000, 0xbdf7, 0xdf1b, 
+  0x39c7, 0x0020, 0x4248, 0xef7d, 0x94b2, 0x0000, 0xb5d6, 0xe75c, 
+  0xef7d, 0xbe17, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0861, 0x9492, 
+  0xe75c, 0xffff, 0xe73c, 0x8410, 0x0020, 0x800c, 0x0000, 0x0002, 
+  0xe75c, 0xad55, 0x800e, 0x0000, 0x0005, 0x52aa, 0xf7de, 0xa534, 
+  0x31a6, 0x0000
+};
\ No newline at end of file
@@ -2,65 +2,30 @@
 
 #include "gfx-sin.h"
 
-const uint8_t gfx_sin[960] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x20, 0x21, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x73, 0x8e, 0xc6, 0x58, 
-  0xf7, 0xde, 0xff, 0xff, 0xf7, 0xde, 0xad, 0x75, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xe7, 0x5c, 0xf7, 0xde, 0xbe, 0x17, 
-  0x7b, 0xef, 0x63, 0x2c, 0x7c, 0x0f, 0xe7, 0x3c, 0xf7, 0xde, 0x6b, 0x6d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x9d, 0x13, 0xff, 0xff, 0xbd, 0xf7, 0x29, 0x65, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0xa5, 0x54, 0xff, 0xff, 0x73, 0xae, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0xa2, 0xce, 0x79, 0xf7, 0xde, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0xf7, 0xde, 0x4a, 0x49, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x18, 0xe3, 0xd6, 0xba, 0xef, 0x9d, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xce, 0x79, 0xdf, 0x1b, 
-  0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xde, 0xfb, 0xef, 0x7d, 0x39, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86, 0xf7, 0xde, 
-  0x94, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 
-  0xc6, 0x38, 0x29, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 
-  0xf7, 0xde, 0x39, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xce, 0x59, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 
-  0xd6, 0xda, 0xde, 0xfb, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x0f, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x31, 0xa6, 0xf7, 0xbe, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x89, 0xf7, 0xde, 0x9d, 0x13, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x63, 0x2c, 0xf7, 0xde, 0x9c, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x48, 0xef, 0x9d, 0xc6, 0x38, 0x08, 0x41, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x73, 0x8e, 0xff, 0xff, 0xad, 0x75, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0xf7, 0xbe, 0xc6, 0x58, 0x10, 0xa2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x0b, 0xf7, 0xbe, 0xde, 0xfb, 0x5b, 0x0b, 0x18, 0xc3, 
-  0x18, 0xe3, 0x5a, 0xcb, 0xce, 0x59, 0xff, 0xff, 0xa5, 0x34, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x5a, 0xeb, 
-  0x5a, 0xcb, 0x29, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_sin[185] = {
+  0x8008, 0x0000, 0x0003, 0x0020, 0x2104, 0x0020, 0x801a, 0x0000, 
+  0x0008, 0x0861, 0x738e, 0xc658, 0xf7de, 0xffff, 0xf7de, 0xad75, 
+  0x3186, 0x8017, 0x0000, 0x000a, 0x52aa, 0xe75c, 0xf7de, 0xbe17, 
+  0x7bef, 0x632c, 0x7c0f, 0xe73c, 0xf7de, 0x6b6d, 0x8014, 0x0000, 
+  0x0005, 0x0841, 0x9d13, 0xffff, 0xbdf7, 0x2965, 0x8004, 0x0000, 
+  0x0004, 0x0861, 0xa554, 0xffff, 0x73ae, 0x8012, 0x0000, 0x0004, 
+  0x10a2, 0xce79, 0xf7de, 0x7bcf, 0x8008, 0x0000, 0x0003, 0x9cf3, 
+  0xf7de, 0x4a49, 0x8010, 0x0000, 0x0004, 0x18e3, 0xd6ba, 0xef9d, 
+  0x4a69, 0x8009, 0x0000, 0x0004, 0x0020, 0xce79, 0xdf1b, 0x0861, 
+  0x800f, 0x0000, 0x0003, 0xdefb, 0xef7d, 0x39e7, 0x800b, 0x0000, 
+  0x0003, 0x3186, 0xf7de, 0x94d2, 0x800e, 0x0000, 0x0003, 0x2965, 
+  0xc638, 0x2985, 0x800d, 0x0000, 0x0003, 0x8c51, 0xf7de, 0x39e7, 
+  0x800c, 0x0000, 0x0002, 0x0020, 0xce59, 0x800f, 0x0000, 0x0004, 
+  0x0841, 0xd6da, 0xdefb, 0x0861, 0x800b, 0x0000, 0x0002, 0x7c0f, 
+  0xffff, 0x8010, 0x0000, 0x0003, 0x31a6, 0xf7be, 0xad75, 0x800a, 
+  0x0000, 0x0003, 0x4a89, 0xf7de, 0x9d13, 0x8011, 0x0000, 0x0003, 
+  0x632c, 0xf7de, 0x9cd3, 0x8008, 0x0000, 0x0004, 0x4248, 0xef9d, 
+  0xc638, 0x0841, 0x8012, 0x0000, 0x0004, 0x738e, 0xffff, 0xad75, 
+  0x1082, 0x8005, 0x0000, 0x0004, 0x6b6d, 0xf7be, 0xc658, 0x10a2, 
+  0x8014, 0x0000, 0x000b, 0x5b0b, 0xf7be, 0xdefb, 0x5b0b, 0x18c3, 
+  0x18e3, 0x5acb, 0xce59, 0xffff, 0xa534, 0x0861, 0x8016, 0x0000, 
+  0x0002, 0x3186, 0xce79, 0x8004, 0xffff, 0x0002, 0xce59, 0x4a69, 
+  0x801a, 0x0000, 0x0004, 0x39c7, 0x5aeb, 0x5acb, 0x2965, 0x8006, 
+  0x0000
 };
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_SIN_HEIGHT (15)
 #define GFX_SIN_WIDTH  (32)
 
-extern const uint8_t gfx_sin[960];
+extern const uint16_t gfx_sin[185];
 
 #endif // __GFX_SIN_H__
\ No newline at end of file
@@ -8,6 +8,6 @@
 #define GFX_SQUARE_HEIGHT (15)
 #define GFX_SQUARE_WIDTH  (32)
 
-extern const uint8_t gfx_square[960];
+extern const uint16_t gfx_square[150];
 
 #endif // __GFX_SQUARE_H__
\ No newline at end of file
@@ -2,98 +2,77 @@
 
 #include "gfx-thermometer.h"
 
-const uint8_t gfx_thermometer[1480] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xeb, 
-  0xbe, 0x17, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xb6, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x82, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x9c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 
-  0x94, 0xd2, 0x42, 0x28, 0x42, 0x28, 0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0x84, 0x50, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x42, 0x28, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8c, 0x71, 0xff, 0xff, 0xf7, 0xbe, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x71, 0xff, 0xff, 0xbe, 0x17, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0xdf, 0x1b, 0xff, 0xff, 0x5a, 0xeb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xa5, 0x14, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x14, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0x7b, 0xcf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xb5, 0xb6, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x5a, 0xeb, 0x9c, 0xd3, 0x9c, 0xf3, 0x5a, 0xcb, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0x73, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0xad, 0x75, 
-  0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0xad, 0x75, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 
-  0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 
-  0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 
-  0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x13, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 
-  0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xd2, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0x6b, 0x6d, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 
-  0xd6, 0xba, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x94, 0xd2, 
-  0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0xb5, 0xd6, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xd6, 0xda, 0xff, 0xff, 0xff, 0xff, 0x63, 0x0c, 0x00, 0x00, 
-  0x9c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0x00, 0x00, 0x84, 0x10, 0xff, 0xff, 0xff, 0xff, 
-  0xbd, 0xd7, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0xd6, 0xda, 0xff, 0xff, 
-  0xef, 0x7d, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x94, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 
-  0x00, 0x00, 0x00, 0x00, 0x6b, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0x08, 0x41, 0x00, 0x00, 
-  0x00, 0x00, 0x94, 0xd2, 0xff, 0xff, 0xef, 0x9d, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0xad, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xeb, 
-  0xf7, 0xde, 0xff, 0xff, 0x73, 0xce, 0x00, 0x00, 0x21, 0x24, 0xf7, 0xde, 0xff, 0xff, 0x6b, 0x6d, 
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0xb5, 0xb6, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 
-  0xb5, 0xb6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x91, 0xff, 0xff, 0xdf, 0x1b, 0x10, 0xa2, 
-  0x7b, 0xcf, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0xce, 0x79, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x99, 0x08, 0x61, 0x00, 0x00, 
-  0x21, 0x04, 0xef, 0x7d, 0xff, 0xff, 0x5a, 0xeb, 0xb5, 0xd6, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x84, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0x94, 0xb2, 
-  0xef, 0x7d, 0xff, 0xff, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x00, 0x00, 
-  0x00, 0x00, 0x73, 0xce, 0xff, 0xff, 0xbd, 0xd7, 0xf7, 0xbe, 0xff, 0xff, 0x42, 0x08, 0x00, 0x00, 
-  0x00, 0x20, 0xc6, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0x00, 0x20, 0x00, 0x00, 0x6b, 0x4d, 0xff, 0xff, 0xc6, 0x58, 
-  0xde, 0xfb, 0xff, 0xff, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x17, 0x00, 0x00, 
-  0x00, 0x00, 0x84, 0x50, 0xff, 0xff, 0xad, 0x75, 0xa5, 0x34, 0xff, 0xff, 0x9d, 0x13, 0x00, 0x00, 
-  0x00, 0x00, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x63, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0x84, 0x30, 
-  0x63, 0x2c, 0xff, 0xff, 0xe7, 0x3c, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x13, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 
-  0x31, 0xa6, 0xf7, 0xde, 0xff, 0xff, 0x42, 0x48, 0x10, 0x82, 0xe7, 0x3c, 0xff, 0xff, 0x9c, 0xf3, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 
-  0x7b, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd6, 0xff, 0xff, 0xc6, 0x58, 0x00, 0x20, 
-  0x00, 0x00, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x10, 0xa2, 0x42, 0x08, 0x42, 0x08, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb2, 
-  0xff, 0xff, 0xff, 0xff, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 
-  0xff, 0xff, 0x94, 0xb2, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xe3, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x84, 0x10, 
-  0x42, 0x08, 0x31, 0xa6, 0x31, 0xa6, 0x42, 0x28, 0x8c, 0x91, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 
-  0x8c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x73, 0x8e, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xd6, 0xda, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x73, 0xae, 0xc6, 0x38, 
-  0xef, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9d, 0xbd, 0xf7, 0x63, 0x2c, 0x10, 0xa2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_thermometer[568] = {
+  0x8007, 0x0000, 0x0006, 0x5aeb, 0xbe17, 0xffff, 0xffff, 0xb5b6, 
+  0x4a69, 0x800c, 0x0000, 0x0002, 0x1082, 0xb5b6, 0x8006, 0xffff, 
+  0x0001, 0x9cf3, 0x800b, 0x0000, 0x000a, 0xa534, 0xffff, 0xffff, 
+  0x94d2, 0x4228, 0x4228, 0xad75, 0xffff, 0xffff, 0x8450, 0x8009, 
+  0x0000, 0x0004, 0x4228, 0xffff, 0xffff, 0x6b8d, 0x8004, 0x0000, 
+  0x0004, 0x8c71, 0xffff, 0xf7be, 0x2124, 0x8008, 0x0000, 0x0003, 
+  0x8c71, 0xffff, 0xbe17, 0x8005, 0x0000, 0x0004, 0x0861, 0xdf1b, 
+  0xffff, 0x5aeb, 0x8008, 0x0000, 0x0003, 0xa514, 0xffff, 0x8410, 
+  0x8006, 0x0000, 0x0003, 0xad95, 0xffff, 0x7bcf, 0x8008, 0x0000, 
+  0x0003, 0xa514, 0xffff, 0x8430, 0x8006, 0x0000, 0x0003, 0xad95, 
+  0xffff, 0x7bcf, 0x8008, 0x0000, 0x0003, 0x9d13, 0xffff, 0x8450, 
+  0x8006, 0x0000, 0x0003, 0xb5b6, 0xffff, 0x73ce, 0x8008, 0x0000, 
+  0x000c, 0x9d13, 0xffff, 0x8430, 0x0000, 0x5aeb, 0x9cd3, 0x9cf3, 
+  0x5acb, 0x0000, 0xad95, 0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 
+  0x9d13, 0xffff, 0x8410, 0x0000, 0xad75, 0xffff, 0xffff, 0xad75, 
+  0x0000, 0xad75, 0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 0x9d13, 
+  0xffff, 0x8430, 0x0000, 0xad75, 0xffff, 0xffff, 0xad75, 0x0000, 
+  0xad75, 0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 0x9d13, 0xffff, 
+  0x8430, 0x0000, 0x9cd3, 0xffff, 0xffff, 0x9cd3, 0x0000, 0xad75, 
+  0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 0x9d13, 0xffff, 0x8430, 
+  0x0000, 0x9cd3, 0xffff, 0xffff, 0x9cd3, 0x0000, 0xad75, 0xffff, 
+  0x73ce, 0x8008, 0x0000, 0x000c, 0x9d13, 0xffff, 0x8430, 0x0000, 
+  0x9cd3, 0xffff, 0xffff, 0x9cd3, 0x0000, 0xad75, 0xffff, 0x73ce, 
+  0x8008, 0x0000, 0x000c, 0x9d13, 0xffff, 0x8430, 0x0000, 0x9cd3, 
+  0xffff, 0xffff, 0x9cd3, 0x0000, 0xad75, 0xffff, 0x73ce, 0x8008, 
+  0x0000, 0x000c, 0x9d13, 0xffff, 0x8430, 0x0000, 0x9cd3, 0xffff, 
+  0xffff, 0x9cd3, 0x0000, 0xad75, 0xffff, 0x73ce, 0x8008, 0x0000, 
+  0x000c, 0x9d13, 0xffff, 0x8430, 0x0000, 0x9cd3, 0xffff, 0xffff, 
+  0x9cd3, 0x0000, 0xad75, 0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 
+  0x9d13, 0xffff, 0x8430, 0x0000, 0x9cd3, 0xffff, 0xffff, 0x9cd3, 
+  0x0000, 0xad75, 0xffff, 0x73ce, 0x8008, 0x0000, 0x000c, 0x94d2, 
+  0xffff, 0x8430, 0x0000, 0x9cd3, 0xffff, 0xffff, 0x9cd3, 0x0000, 
+  0xad75, 0xffff, 0x6b6d, 0x8007, 0x0000, 0x000e, 0x2104, 0xd6ba, 
+  0xffff, 0x8c71, 0x0000, 0x9cd3, 0xffff, 0xffff, 0x94d2, 0x0000, 
+  0xbdf7, 0xffff, 0xb5d6, 0x0841, 0x8005, 0x0000, 0x0055, 0x2945, 
+  0xd6da, 0xffff, 0xffff, 0x630c, 0x0000, 0x9cf3, 0xffff, 0xffff, 
+  0x9cf3, 0x0000, 0x8410, 0xffff, 0xffff, 0xbdd7, 0x0861, 0x0000, 
+  0x0000, 0x0000, 0x1082, 0xd6da, 0xffff, 0xef7d, 0x5acb, 0x0000, 
+  0x0000, 0x94d2, 0xffff, 0xffff, 0x9cf3, 0x0000, 0x0000, 0x6b8d, 
+  0xffff, 0xffff, 0xbdd7, 0x0841, 0x0000, 0x0000, 0x94d2, 0xffff, 
+  0xef9d, 0x39c7, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xffff, 
+  0xad95, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xf7de, 0xffff, 0x73ce, 
+  0x0000, 0x2124, 0xf7de, 0xffff, 0x6b6d, 0x0000, 0x0000, 0x18c3, 
+  0xb5b6, 0xf7be, 0xffff, 0xffff, 0xf7be, 0xb5b6, 0x18e3, 0x0000, 
+  0x0000, 0x8c91, 0xffff, 0xdf1b, 0x10a2, 0x7bcf, 0xffff, 0xd6ba, 
+  0x0000, 0x0000, 0x0861, 0xce79, 0x8006, 0xffff, 0x000d, 0xce99, 
+  0x0861, 0x0000, 0x2104, 0xef7d, 0xffff, 0x5aeb, 0xb5d6, 0xffff, 
+  0x8430, 0x0000, 0x0000, 0x8430, 0x8008, 0xffff, 0x000c, 0x8c71, 
+  0x0000, 0x0000, 0xa534, 0xffff, 0x94b2, 0xef7d, 0xffff, 0x4a69, 
+  0x0000, 0x0000, 0xc618, 0x8008, 0xffff, 0x000c, 0xc638, 0x0000, 
+  0x0000, 0x73ce, 0xffff, 0xbdd7, 0xf7be, 0xffff, 0x4208, 0x0000, 
+  0x0020, 0xc658, 0x8008, 0xffff, 0x000c, 0xce79, 0x0020, 0x0000, 
+  0x6b4d, 0xffff, 0xc658, 0xdefb, 0xffff, 0x5aeb, 0x0000, 0x0000, 
+  0xbdf7, 0x8008, 0xffff, 0x000c, 0xbe17, 0x0000, 0x0000, 0x8450, 
+  0xffff, 0xad75, 0xa534, 0xffff, 0x9d13, 0x0000, 0x0000, 0x630c, 
+  0x8008, 0xffff, 0x000d, 0x634c, 0x0000, 0x0000, 0xbdf7, 0xffff, 
+  0x8430, 0x632c, 0xffff, 0xe73c, 0x1082, 0x0000, 0x0000, 0x9d13, 
+  0x8006, 0xffff, 0x0036, 0xa534, 0x0000, 0x0000, 0x31a6, 0xf7de, 
+  0xffff, 0x4248, 0x1082, 0xe73c, 0xffff, 0x9cf3, 0x0000, 0x0000, 
+  0x0000, 0x7bef, 0xd6ba, 0xffff, 0xffff, 0xd6ba, 0x7bef, 0x0000, 
+  0x0000, 0x0000, 0xb5d6, 0xffff, 0xc658, 0x0020, 0x0000, 0x6b4d, 
+  0xffff, 0xffff, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x10a2, 0x4208, 
+  0x4208, 0x18c3, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 
+  0x4a69, 0x0000, 0x0000, 0x0000, 0xa534, 0xffff, 0xffff, 0x94b2, 
+  0x10a2, 0x8006, 0x0000, 0x0005, 0x18e3, 0xad55, 0xffff, 0xffff, 
+  0x8430, 0x8004, 0x0000, 0x000f, 0x0841, 0xad95, 0xffff, 0xffff, 
+  0xe73c, 0x8410, 0x4208, 0x31a6, 0x31a6, 0x4228, 0x8c91, 0xef7d, 
+  0xffff, 0xffff, 0x8c91, 0x8007, 0x0000, 0x0006, 0x738e, 0xef7d, 
+  0xffff, 0xffff, 0xffff, 0xf7de, 0x8004, 0xffff, 0x0002, 0xd6da, 
+  0x5aeb, 0x8009, 0x0000, 0x000a, 0x2104, 0x73ae, 0xc638, 0xef9d, 
+  0xffff, 0xffff, 0xef9d, 0xbdf7, 0x632c, 0x10a2, 0x8005, 0x0000
 };
\ No newline at end of file
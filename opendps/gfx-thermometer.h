@@ -8,6 +8,6 @@
 #define GFX_THERMOMETER_HEIGHT (37)
 #define GFX_THERMOMETER_WIDTH  (20)
 
-extern const uint8_t gfx_thermometer[1480];
+extern const uint16_t gfx_thermometer[568];
 
 #endif // __GFX_THERMOMETER_H__
\ No newline at end of file
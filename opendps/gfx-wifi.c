@@ -2,43 +2,32 @@
 
 #include "gfx-wifi.h"
 
-const uint8_t gfx_wifi[608] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x29, 0x65, 0x52, 0xca, 
-  0x73, 0xae, 0xbd, 0xd7, 0x7b, 0xcf, 0x5a, 0xcb, 0x31, 0x86, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0x7b, 0xcf, 
-  0xce, 0x59, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 
-  0xce, 0x99, 0x7c, 0x0f, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-  0x6b, 0x6d, 0xdf, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0xce, 0x59, 0xbe, 0x17, 
-  0xce, 0x59, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x73, 0xae, 0x00, 0x20, 
-  0x00, 0x00, 0x18, 0xc3, 0xa5, 0x54, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5c, 0x8c, 0x71, 0x39, 0xc7, 
-  0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x39, 0xc7, 0x8c, 0x71, 0xe7, 0x3c, 
-  0xff, 0xff, 0xff, 0xff, 0xb5, 0xb6, 0x18, 0xe3, 0x31, 0xa6, 0xef, 0x7d, 0xff, 0xff, 0x9d, 0x13, 
-  0x21, 0x04, 0x21, 0x24, 0x7b, 0xcf, 0xbd, 0xf7, 0xde, 0xfb, 0xe7, 0x3c, 0xde, 0xfb, 0xbd, 0xf7, 
-  0x7b, 0xef, 0x21, 0x44, 0x21, 0x04, 0x9d, 0x13, 0xff, 0xff, 0xe7, 0x3c, 0x31, 0x86, 0x00, 0x00, 
-  0x42, 0x28, 0x6b, 0x6d, 0x10, 0x82, 0x84, 0x30, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9d, 0x8c, 0x71, 0x10, 0xa2, 0x6b, 0x4d, 
-  0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x54, 0xff, 0xff, 0xff, 0xff, 
-  0xde, 0xfb, 0x8c, 0x71, 0x52, 0xaa, 0x42, 0x28, 0x52, 0xaa, 0x8c, 0x71, 0xd6, 0xda, 0xff, 0xff, 
-  0xff, 0xff, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x42, 0x48, 0xde, 0xfb, 0x8c, 0x51, 0x10, 0xa2, 0x29, 0x65, 0x63, 0x4c, 0x7b, 0xef, 0x6b, 0x4d, 
-  0x29, 0x85, 0x10, 0xa2, 0x84, 0x30, 0xd6, 0xda, 0x3a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x21, 0x04, 0xa5, 0x54, 0xf7, 0xbe, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xa5, 0x54, 0x21, 0x04, 0x10, 0xa2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x39, 0xe7, 0xef, 0x9d, 0xff, 0xff, 0xc6, 0x18, 0xa5, 0x34, 0xc6, 0x18, 0xff, 0xff, 0xef, 0x7d, 
-  0x31, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x4a, 0x69, 0x08, 0x61, 0x21, 0x04, 
-  0x08, 0x61, 0x4a, 0x69, 0x39, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x21, 0x24, 0xce, 0x59, 0xef, 0x9d, 0xce, 0x59, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x54, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x5a, 0xeb, 0xf7, 0xde, 0xff, 0xff, 0xf7, 0xde, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0x94, 0xb2, 0x42, 0x28, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/** Run length encoded bgr565 pixels, see tft_blit_rle(...) */
+const uint16_t gfx_wifi[207] = {
+  0x8005, 0x0000, 0x0009, 0x0020, 0x2965, 0x52ca, 0x73ae, 0xbdd7, 
+  0x7bcf, 0x5acb, 0x3186, 0x0841, 0x8008, 0x0000, 0x0004, 0x18e3, 
+  0x7bcf, 0xce59, 0xf7be, 0x8005, 0xffff, 0x0004, 0xf7be, 0xce99, 
+  0x7c0f, 0x2104, 0x8004, 0x0000, 0x003e, 0x0020, 0x6b6d, 0xdf1b, 
+  0xffff, 0xffff, 0xffff, 0xe73c, 0xce59, 0xbe17, 0xce59, 0xe73c, 
+  0xffff, 0xffff, 0xffff, 0xe73c, 0x73ae, 0x0020, 0x0000, 0x18c3, 
+  0xa554, 0xffff, 0xffff, 0xe75c, 0x8c71, 0x39c7, 0x10a2, 0x10a2, 
+  0x18c3, 0x10a2, 0x10a2, 0x39c7, 0x8c71, 0xe73c, 0xffff, 0xffff, 
+  0xb5b6, 0x18e3, 0x31a6, 0xef7d, 0xffff, 0x9d13, 0x2104, 0x2124, 
+  0x7bcf, 0xbdf7, 0xdefb, 0xe73c, 0xdefb, 0xbdf7, 0x7bef, 0x2144, 
+  0x2104, 0x9d13, 0xffff, 0xe73c, 0x3186, 0x0000, 0x4228, 0x6b6d, 
+  0x1082, 0x8430, 0xef7d, 0x8007, 0xffff, 0x0005, 0xef9d, 0x8c71, 
+  0x10a2, 0x6b4d, 0x39c7, 0x8004, 0x0000, 0x000d, 0xa554, 0xffff, 
+  0xffff, 0xdefb, 0x8c71, 0x52aa, 0x4228, 0x52aa, 0x8c71, 0xd6da, 
+  0xffff, 0xffff, 0xad75, 0x8006, 0x0000, 0x000d, 0x4248, 0xdefb, 
+  0x8c51, 0x10a2, 0x2965, 0x634c, 0x7bef, 0x6b4d, 0x2985, 0x10a2, 
+  0x8430, 0xd6da, 0x3a07, 0x8007, 0x0000, 0x000b, 0x18c3, 0x2104, 
+  0xa554, 0xf7be, 0xffff, 0xffff, 0xffff, 0xf7de, 0xa554, 0x2104, 
+  0x10a2, 0x8009, 0x0000, 0x0009, 0x39e7, 0xef9d, 0xffff, 0xc618, 
+  0xa534, 0xc618, 0xffff, 0xef7d, 0x31a6, 0x800b, 0x0000, 0x0007, 
+  0x4208, 0x4a69, 0x0861, 0x2104, 0x0861, 0x4a69, 0x39e7, 0x800d, 
+  0x0000, 0x0005, 0x2124, 0xce59, 0xef9d, 0xce59, 0x2124, 0x800e, 
+  0x0000, 0x0005, 0xa554, 0xffff, 0xffff, 0xffff, 0xa554, 0x800e, 
+  0x0000, 0x0005, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x800e, 
+  0x0000, 0x0005, 0x5aeb, 0xf7de, 0xffff, 0xf7de, 0x5aeb, 0x800f, 
+  0x0000, 0x0003, 0x4228, 0x94b2, 0x4228, 0x8008, 0x0000
 };
\ No newline at end of file
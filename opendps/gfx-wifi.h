@@ -8,6 +8,6 @@
 #define GFX_WIFI_HEIGHT (16)
 #define GFX_WIFI_WIDTH  (19)
 
-extern const uint8_t gfx_wifi[608];
+extern const uint16_t gfx_wifi[207];
 
 #endif // __GFX_WIFI_H__
\ No newline at end of file
@@ -15,11 +15,12 @@
   *   - Two 2-bit pixels at a time means the result is a pair of two 16-bit bgr565 pixels -- a single uint32_t is used to describe both in one value
   *   - Originally, this was a 256-entry uint64_t array, and allowed expanding all 4 pixels for an input byte in a single operation
   *   - The 64-bit table used a lot more flash space.
+  * The pixels are in native byte order, the decoded glyphs are sent to the TFT using 16-bit SPI frames.
   */
 
 const uint32_t mono2bpp_lookup[16] = {
-    0x00000000, 0x0000AA52, 0x000054A5, 0x0000FFFF,
-    0xAA520000, 0xAA52AA52, 0xAA5254A5, 0xAA52FFFF,
-    0x54A50000, 0x54A5AA52, 0x54A554A5, 0x54A5FFFF,
-    0xFFFF0000, 0xFFFFAA52, 0xFFFF54A5, 0xFFFFFFFF,
+    0x00000000, 0x000052AA, 0x0000A554, 0x0000FFFF,
+    0x52AA0000, 0x52AA52AA, 0x52AAA554, 0x52AAFFFF,
+    0xA5540000, 0xA55452AA, 0xA554A554, 0xA554FFFF,
+    0xFFFF0000, 0xFFFF52AA, 0xFFFFA554, 0xFFFFFFFF,
 };
@@ -0,0 +1,400 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <flash.h>
+#include "dbg_printf.h"
+#include "flashlock.h"
+#include "tick.h"
+#include "swtimer.h"
+#include "hw.h"
+#include "pwrctl.h"
+#include "history.h"
+
+/*
+ * History - measurement log
+ *
+ * The history module keeps a downsampled log of V_out, I_out, V_in and the
+ * output energy in a dedicated flash area, separate from past, so the
+ * measurement history survives while the network companion is offline.
+ *
+ * The log area is a ring of 1k flash pages. Each page begins with a two word
+ * page header holding a sequence number that increases by one for each new
+ * page and a check word, the sequence number xor HISTORY_PAGE_MAGIC. The
+ * check word keeps leftover application code in the log area from being
+ * taken for a page header.
+ * When the current page is full, the next page (holding the oldest data) is
+ * erased and becomes the current one. A log position is the sequence number
+ * of a page times the number of words in a page plus the word index inside
+ * the page, which allows the host to resume a download where it left off.
+ *
+ * Only whole words are ever written. The top four bits of a word tell what
+ * the word holds:
+ *
+ *  [0xxx]  Delta sample, the difference from the previous sample:
+ *          [30:20] V_out delta (10mV), [19:9] I_out delta (mA),
+ *          [8:0] V_in delta (10mV), all signed
+ *  [1010]  Time: [27:0] uptime in seconds of the next sample. Starts a new
+ *          session, delta samples are invalid until the next absolute sample
+ *  [1011]  Page header: [27:0] page sequence number, followed by
+ *          [1011] [27:0] sequence number xor HISTORY_PAGE_MAGIC
+ *  [1100]  Absolute sample: [27:15] V_out (10mV), [14:0] I_out (mA)
+ *  [1101]  V_in: [12:0] V_in (10mV) for the next absolute sample
+ *  [1110]  Energy: [27:0] output energy since boot (mWh)
+ *  [1111]  Erased (0xffffffff) or a word torn by a power loss, skipped
+ *
+ * Every sample is stored as a delta word if the deltas fit, otherwise as a
+ * V_in word followed by an absolute sample. Each session and each page start
+ * with a time word followed by absolute values so every page can be decoded
+ * on its own once older pages have been overwritten. Samples follow each
+ * other at history_interval() seconds. The energy word is written with each
+ * absolute sample and every HISTORY_ENERGY_INTERVAL samples when changed.
+ */
+
+#define HISTORY_PAGE_SIZE       (1024)
+#define HISTORY_WORDS_PER_PAGE  (HISTORY_PAGE_SIZE / 4)
+
+#define HISTORY_TAG(w)          ((w) >> 28)
+#define HISTORY_TAG_TIME        (0xa)
+#define HISTORY_TAG_PAGE        (0xb)
+#define HISTORY_TAG_SAMPLE      (0xc)
+#define HISTORY_TAG_VIN         (0xd)
+#define HISTORY_TAG_ENERGY      (0xe)
+#define HISTORY_WORD(tag, data) (((uint32_t) (tag) << 28) | ((data) & 0x0fffffff))
+#define HISTORY_ERASED          (0xffffffff)
+
+/** Page header words */
+#define HISTORY_HEADER_WORDS    (2)
+#define HISTORY_PAGE_MAGIC      (0x0d15a7e)
+#define HISTORY_CHECK_WORD(seq) HISTORY_WORD(HISTORY_TAG_PAGE, (seq) ^ HISTORY_PAGE_MAGIC)
+
+/** Delta word field ranges */
+#define DELTA_VOUT_MAX  (1023)
+#define DELTA_IOUT_MAX  (1023)
+#define DELTA_VIN_MAX   (255)
+
+/** Measurements are sampled this often and averaged into one record */
+#define HISTORY_SAMPLE_MS  (1000)
+
+#ifndef CONFIG_HISTORY_INTERVAL
+ /** Seconds between two log records */
+ #define CONFIG_HISTORY_INTERVAL  (10)
+#endif // CONFIG_HISTORY_INTERVAL
+
+/** Write an energy word every this many delta samples */
+#define HISTORY_ENERGY_INTERVAL  (16)
+
+/** The largest record, time + V_in + energy + absolute sample */
+#define HISTORY_MAX_RECORD_WORDS  (4)
+
+static uint32_t log_base;
+static uint32_t log_num_pages;
+static uint32_t cur_page;
+static uint32_t cur_seq;
+static uint32_t write_addr;
+static bool log_valid;
+
+/** Last written sample, in the units of the log */
+static uint32_t last_v_out;
+static uint32_t last_i_out;
+static uint32_t last_v_in;
+/** A time word and absolute values are needed before the next delta */
+static bool need_time;
+static bool need_absolute;
+static uint32_t samples_since_energy;
+static uint32_t last_energy_mwh;
+
+/** Measurement accumulation */
+static void sample_fired(swtimer_t *timer);
+static swtimer_t sample_timer = { .callback = &sample_fired };
+static uint64_t last_sample;
+static uint32_t num_samples;
+static uint32_t v_out_sum;
+static uint32_t i_out_sum;
+static uint32_t v_in_sum;
+/** Output energy since boot in mJ */
+static uint64_t energy_mj;
+
+static inline uint32_t page_addr(uint32_t page)
+{
+    return log_base + page * HISTORY_PAGE_SIZE;
+}
+
+static inline uint32_t flash_read32(uint32_t address)
+{
+    return *((uint32_t*) address);
+}
+
+/**
+  * @brief Write one word to flash
+  * @param address address to write to
+  * @param data data to write
+  * @retval true if the write was successful
+  */
+static bool flash_write32(uint32_t address, uint32_t data)
+{
+    flash_program_word(address, data);
+    return (FLASH_SR_EOP & flash_get_status_flags()) && flash_read32(address) == data;
+}
+
+/**
+  * @brief Erase the next page of the ring and make it the current one
+  * @retval true if successful
+  */
+static bool history_next_page(void)
+{
+    bool success = false;
+    uint32_t page = (cur_page + 1) % log_num_pages;
+    unlock_flash();
+    do {
+        flash_erase_page(page_addr(page));
+        if (!(FLASH_SR_EOP & flash_get_status_flags())) {
+            break;
+        }
+        if (!flash_write32(page_addr(page), HISTORY_WORD(HISTORY_TAG_PAGE, cur_seq + 1)) ||
+            !flash_write32(page_addr(page) + 4, HISTORY_CHECK_WORD(cur_seq + 1))) {
+            break;
+        }
+        cur_page = page;
+        cur_seq++;
+        write_addr = page_addr(page) + 4 * HISTORY_HEADER_WORDS;
+        /** Each page must be decodable on its own */
+        need_time = true;
+        need_absolute = true;
+        success = true;
+    } while(0);
+    lock_flash();
+    return success;
+}
+
+/**
+  * @brief Initialize the history log, find the newest page and the write
+  *        position or format the log area if it contains no valid pages,
+  *        then start sampling the measurements
+  * @param base address of the first flash page of the log area
+  * @param num_pages number of 1k flash pages in the log area (at least 2)
+  * @retval none
+  */
+void history_init(uint32_t base, uint32_t num_pages)
+{
+    bool found = false;
+    log_base = base;
+    log_num_pages = num_pages;
+    log_valid = false;
+    need_time = true;
+    need_absolute = true;
+
+    for (uint32_t i = 0; i < log_num_pages; i++) {
+        uint32_t header = flash_read32(page_addr(i));
+        uint32_t seq = header & 0x0fffffff;
+        if (HISTORY_TAG(header) == HISTORY_TAG_PAGE && flash_read32(page_addr(i) + 4) == HISTORY_CHECK_WORD(seq)) {
+            if (!found || seq > cur_seq) {
+                cur_seq = seq;
+                cur_page = i;
+                found = true;
+            }
+        }
+    }
+
+    if (!found) {
+        /** Start over with page 0 as sequence 0 */
+        cur_page = log_num_pages - 1;
+        cur_seq = (uint32_t) -1;
+        log_valid = history_next_page();
+    } else {
+        /** Continue after the last word written, torn words included */
+        uint32_t addr = page_addr(cur_page) + HISTORY_PAGE_SIZE;
+        while (addr > page_addr(cur_page) + 4 * HISTORY_HEADER_WORDS && flash_read32(addr - 4) == HISTORY_ERASED) {
+            addr -= 4;
+        }
+        write_addr = addr;
+        log_valid = true;
+    }
+    if (log_valid) {
+        swtimer_start(&sample_timer, HISTORY_SAMPLE_MS, HISTORY_SAMPLE_MS);
+    } else {
+        dbg_printf("Error: history init failed!\n");
+    }
+}
+
+/**
+  * @brief Append a record to the log, moving to the next page if needed
+  * @param v_out V_out in 10mV
+  * @param i_out I_out in mA
+  * @param v_in V_in in 10mV
+  * @retval none
+  */
+static void history_append(uint32_t v_out, uint32_t i_out, uint32_t v_in)
+{
+    uint32_t words[HISTORY_MAX_RECORD_WORDS];
+    uint32_t num_words;
+    /** 1 mWh is 3600 mJ */
+    uint32_t energy_mwh = (uint32_t) (energy_mj / 3600);
+
+    do {
+        int32_t dv_out = (int32_t) v_out - (int32_t) last_v_out;
+        int32_t di_out = (int32_t) i_out - (int32_t) last_i_out;
+        int32_t dv_in = (int32_t) v_in - (int32_t) last_v_in;
+        num_words = 0;
+        if (need_time) {
+            words[num_words++] = HISTORY_WORD(HISTORY_TAG_TIME, (uint32_t) (get_ticks() / 1000));
+            need_absolute = true;
+        }
+        if (need_absolute ||
+            dv_out > DELTA_VOUT_MAX || dv_out < -DELTA_VOUT_MAX ||
+            di_out > DELTA_IOUT_MAX || di_out < -DELTA_IOUT_MAX ||
+            dv_in > DELTA_VIN_MAX || dv_in < -DELTA_VIN_MAX) {
+            words[num_words++] = HISTORY_WORD(HISTORY_TAG_VIN, v_in & 0x1fff);
+            words[num_words++] = HISTORY_WORD(HISTORY_TAG_ENERGY, energy_mwh);
+            words[num_words++] = HISTORY_WORD(HISTORY_TAG_SAMPLE, ((v_out & 0x1fff) << 15) | (i_out & 0x7fff));
+            samples_since_energy = 0;
+        } else {
+            if (++samples_since_energy >= HISTORY_ENERGY_INTERVAL && energy_mwh != last_energy_mwh) {
+                words[num_words++] = HISTORY_WORD(HISTORY_TAG_ENERGY, energy_mwh);
+                samples_since_energy = 0;
+            }
+            words[num_words++] = ((uint32_t) (dv_out & 0x7ff) << 20) | ((uint32_t) (di_out & 0x7ff) << 9) | ((uint32_t) dv_in & 0x1ff);
+        }
+        if (write_addr + 4 * num_words <= page_addr(cur_page) + HISTORY_PAGE_SIZE) {
+            break;
+        }
+        /** Does not fit, start a new page and redo the record as a keyframe */
+        if (!history_next_page()) {
+            log_valid = false;
+            return;
+        }
+    } while(1);
+
+    unlock_flash();
+    for (uint32_t i = 0; i < num_words; i++) {
+        if (!flash_write32(write_addr, words[i])) {
+            /** Skip the bad word and resync with absolute values */
+            dbg_printf("Error: history write failed!\n");
+            write_addr += 4;
+            need_time = true;
+            lock_flash();
+            return;
+        }
+        write_addr += 4;
+    }
+    lock_flash();
+
+    if (num_words > 1) {
+        /** All records but a lone delta word carry the energy */
+        last_energy_mwh = energy_mwh;
+    }
+    need_time = false;
+    need_absolute = false;
+    last_v_out = v_out;
+    last_i_out = i_out;
+    last_v_in = v_in;
+}
+
+/**
+  * @brief Sample the measurements and append a record to the log when a
+  *        full history interval has been accumulated
+  * @param timer the sample timer
+  * @retval none
+  */
+static void sample_fired(swtimer_t *timer)
+{
+    (void) timer;
+    uint64_t now = get_ticks();
+    uint32_t elapsed_ms = last_sample ? (uint32_t) (now - last_sample) : HISTORY_SAMPLE_MS;
+    last_sample = now;
+
+    uint16_t i_out_raw, v_in_raw, v_out_raw;
+    hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
+    uint32_t v_out = pwrctl_vout_enabled() ? pwrctl_calc_vout(v_out_raw) : 0;
+    uint32_t i_out = pwrctl_vout_enabled() ? pwrctl_calc_iout(i_out_raw) : 0;
+    uint32_t v_in = pwrctl_calc_vin(v_in_raw);
+
+    /** mV * mA = uW, times ms gives nJ */
+    energy_mj += ((uint64_t) v_out * i_out * elapsed_ms) / 1000000;
+    v_out_sum += v_out;
+    i_out_sum += i_out;
+    v_in_sum += v_in;
+
+    if (++num_samples * HISTORY_SAMPLE_MS >= CONFIG_HISTORY_INTERVAL * 1000) {
+        history_append((v_out_sum / num_samples + 5) / 10, i_out_sum / num_samples, (v_in_sum / num_samples + 5) / 10);
+        num_samples = 0;
+        v_out_sum = i_out_sum = v_in_sum = 0;
+    }
+}
+
+/**
+  * @brief Read raw log words starting at a position in the log
+  * @param offset log position (in words) to read from, positions older than
+  *        the oldest page still in flash are moved forward to that page
+  * @param words buffer receiving up to HISTORY_CHUNK_WORDS words
+  * @param count number of words read
+  * @retval the log position of the first word read
+  */
+uint32_t history_read(uint32_t offset, uint32_t *words, uint32_t *count)
+{
+    uint32_t head = history_head();
+    uint32_t oldest_seq = cur_seq >= log_num_pages - 1 ? cur_seq - (log_num_pages - 1) : 0;
+    uint32_t oldest = oldest_seq * HISTORY_WORDS_PER_PAGE;
+    *count = 0;
+    if (offset < oldest) {
+        offset = oldest;
+    }
+    if (offset >= head) {
+        return head;
+    }
+    uint32_t seq = offset / HISTORY_WORDS_PER_PAGE;
+    uint32_t index = offset % HISTORY_WORDS_PER_PAGE;
+    /** Pages are used in order, the page for a sequence follows from the current one */
+    uint32_t page = (cur_page + log_num_pages - (cur_seq - seq) % log_num_pages) % log_num_pages;
+    uint32_t addr = page_addr(page) + 4 * index;
+    if (flash_read32(page_addr(page)) != HISTORY_WORD(HISTORY_TAG_PAGE, seq)) {
+        /** Page not written yet, eg. a log area that has not wrapped */
+        return offset + HISTORY_WORDS_PER_PAGE - index;
+    }
+    while (*count < HISTORY_CHUNK_WORDS && index < HISTORY_WORDS_PER_PAGE && offset + *count < head) {
+        words[(*count)++] = flash_read32(addr);
+        addr += 4;
+        index++;
+    }
+    return offset;
+}
+
+/**
+  * @brief Get the log position following the last word written
+  * @retval log head position in words
+  */
+uint32_t history_head(void)
+{
+    return cur_seq * HISTORY_WORDS_PER_PAGE + (write_addr - page_addr(cur_page)) / 4;
+}
+
+/**
+  * @brief Get the interval between two log records
+  * @retval interval in seconds
+  */
+uint32_t history_interval(void)
+{
+    return CONFIG_HISTORY_INTERVAL;
+}
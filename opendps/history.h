@@ -0,0 +1,67 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __HISTORY_H__
+#define __HISTORY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Number of words returned by one history_read(...) call, sized to fit a
+  * fully escaped uframe */
+#define HISTORY_CHUNK_WORDS  (11)
+
+/**
+  * @brief Initialize the history log, find the newest page and the write
+  *        position or format the log area if it contains no valid pages,
+  *        then start sampling the measurements
+  * @param base address of the first flash page of the log area
+  * @param num_pages number of 1k flash pages in the log area (at least 2)
+  * @retval none
+  */
+void history_init(uint32_t base, uint32_t num_pages);
+
+/**
+  * @brief Read raw log words starting at a position in the log
+  * @param offset log position (in words) to read from, positions older than
+  *        the oldest page still in flash are moved forward to that page
+  * @param words buffer receiving up to HISTORY_CHUNK_WORDS words
+  * @param count number of words read
+  * @retval the log position of the first word read
+  */
+uint32_t history_read(uint32_t offset, uint32_t *words, uint32_t *count);
+
+/**
+  * @brief Get the log position following the last word written
+  * @retval log head position in words
+  */
+uint32_t history_head(void);
+
+/**
+  * @brief Get the interval between two log records
+  * @retval interval in seconds
+  */
+uint32_t history_interval(void);
+
+#endif // __HISTORY_H__
@@ -26,6 +26,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <dac.h>
+#include <dma.h>
 #include <timer.h>
 #include <rcc.h>
 #include <adc.h>
@@ -34,11 +35,14 @@
 #include <exti.h>
 #include <usart.h>
 #include <scb.h>
+#include <cortex.h>
 #include "tick.h"
+#include "swtimer.h"
 #include "spi_driver.h"
 #include "pwrctl.h"
 #include "hw.h"
 #include "event.h"
+#include "rxframe.h"
 #include "dps-model.h"
 #include "uui.h"
 #include "opendps.h"
@@ -60,9 +64,7 @@ static void dac_init(void);
 static void button_irq_init(void);
 static void copy_vectors(void);
 #ifdef CONFIG_FUNCGEN_ENABLE
-static void tim3_init(void);
-void (*funcgen_tick)(void) = &fg_noop;
-volatile uint16_t cur_time_hiw;
+static void tim6_init(void);
 #endif
 
 static volatile uint16_t i_out_adc;
@@ -82,6 +84,13 @@ static uint16_t avg_count;
 static volatile uint16_t i_out_adc_avg;
 static volatile uint16_t v_in_adc_avg;
 static volatile uint16_t v_out_adc_avg;
+/** Set while an event_measurement is queued, so a busy main loop does not get
+    its event queue filled with measurements */
+static volatile bool measurement_pending;
+/** The averaged values last notified with event_measurement */
+static uint16_t i_out_adc_notified;
+static uint16_t v_in_adc_notified;
+static uint16_t v_out_adc_notified;
 
 typedef enum {
     adc_cha_i_out = 0,
@@ -96,8 +105,9 @@ const uint8_t channels[adc_cha_max] = { ADC_CHA_IOUT, ADC_CHA_VIN, ADC_CHA_VOUT
 
 /** Used to handle long presses */
 #define LONGPRESS_TIME_MS (1000)
+static void longpress_fired(swtimer_t *timer);
+static swtimer_t longpress_timer = { .callback = &longpress_fired };
 static volatile event_t longpress_event;
-static volatile uint64_t longpress_start;
 static volatile bool longpress_detected;
 /** Used to filter SET press from SET + ROT */
 static volatile bool set_pressed = false;
@@ -108,6 +118,18 @@ static volatile bool m1_and_m2_pressed = false;
 
 #define DEBOUNCE_TIME_MS    (30)
 
+/** Used to measure the CPU load in hw_idle(), in systick counts */
+#define LOAD_WINDOW_COUNTS (1000 * TICK_COUNTS_PER_MS)
+static bool load_running;
+static uint32_t load_start;
+static uint32_t load_idle;
+static uint32_t load_max_busy;
+static uint32_t load_wakeups;
+static uint32_t busy_start;
+static uint16_t idle_permille;
+static uint32_t max_busy_us;
+static uint32_t wakeups_per_second;
+
 /** We skip the first 40 samples. For a connected ESP8266 the first sample
   * will read a current draw of ~3A which will trigger the OCP.
   * @todo Investigate if the ESP8266 _really_ draws 3A or if it is a DPS issue
@@ -167,7 +189,7 @@ void hw_init(void)
     dac_init();
     button_irq_init();
 #ifdef CONFIG_FUNCGEN_ENABLE
-    tim3_init();
+    tim6_init();
 #endif
 
 //    AFIO_MAPR |= AFIO_MAPR_PD01_REMAP; /** @todo The original DPS FW does this, things go south if I do it... */
@@ -187,6 +209,16 @@ void hw_get_adc_values(uint16_t *i_out_raw, uint16_t *v_in_raw, uint16_t *v_out_
     *v_out_raw = v_out_adc_avg;
 }
 
+/**
+  * @brief Acknowledge an event_measurement, the next change of the averaged
+  *        ADC values will be notified
+  * @retval none
+  */
+void hw_ack_measurement(void)
+{
+    measurement_pending = false;
+}
+
 /**
   * @brief Set the output voltage DAC value
   * @param v_dac the value to set to
@@ -263,20 +295,77 @@ uint16_t hw_get_vtrig_mv(void)
 }
 
 /**
-  * @brief Check if it current press is a long press, inject event if so
+  * @brief The button has been held down long enough, inject a long press event
+  * @param timer the long press timer
   * @retval None
   */
-void hw_longpress_check(void)
+static void longpress_fired(swtimer_t *timer)
 {
+    (void) timer;
+    /** Masked so the release ISR sees either both or none of the changes */
+    cm_disable_interrupts();
     if (longpress_event != event_none) {
-        if (get_ticks() - longpress_start > LONGPRESS_TIME_MS) {
-            event_put(longpress_event, press_long);
-            longpress_detected = true;
-            longpress_event = event_none;
+        event_put(longpress_event, press_long);
+        longpress_detected = true;
+        longpress_event = event_none;
+    }
+    cm_enable_interrupts();
+}
+
+/**
+  * @brief Sleep until the next interrupt unless an event is pending, the 1ms
+  *        systick bounds the sleep so the software timers stay on time
+  * @retval None
+  */
+void hw_idle(void)
+{
+    /** Interrupts are masked so an event posted after the check still wakes
+        the WFI, its handler runs when they are unmasked */
+    cm_disable_interrupts();
+    uint32_t now = get_tick_counts();
+    if (!load_running) {
+        load_running = true;
+        load_start = busy_start = now;
+    }
+    if (!event_pending()) {
+        uint32_t busy = now - busy_start;
+        if (busy > load_max_busy) {
+            load_max_busy = busy;
         }
+        __asm__ volatile ("wfi");
+        busy_start = get_tick_counts();
+        load_idle += busy_start - now;
+        load_wakeups++;
+    }
+    cm_enable_interrupts();
+
+    if (busy_start - load_start >= LOAD_WINDOW_COUNTS) {
+        uint32_t window = busy_start - load_start;
+        idle_permille = (uint64_t) load_idle * 1000 / window;
+        max_busy_us = load_max_busy / (TICK_COUNTS_PER_MS / 1000);
+        wakeups_per_second = (uint64_t) load_wakeups * LOAD_WINDOW_COUNTS / window;
+        load_start = busy_start;
+        load_idle = 0;
+        load_max_busy = 0;
+        load_wakeups = 0;
     }
 }
 
+/**
+  * @brief Get the CPU load of the last second
+  * @param idle (out) time spent sleeping in hw_idle() in 0.1%
+  * @param max_busy (out) the longest time between two sleeps in us, events
+  *        arriving while the CPU is awake wait at most this long
+  * @param wakeups (out) number of wakeups per second
+  * @retval None
+  */
+void hw_get_load(uint16_t *idle, uint32_t *max_busy, uint32_t *wakeups)
+{
+    *idle = idle_permille;
+    *max_busy = max_busy_us;
+    *wakeups = wakeups_per_second;
+}
+
 #ifdef CONFIG_ADC_BENCHMARK
 /**
   * @brief Print ADC speed
@@ -409,11 +498,14 @@ void adc1_2_isr(void)
         avg_v_in_sum  = 0;
         avg_v_out_sum = 0;
         avg_count     = 0;
+        if (!measurement_pending &&
+            (i_out_adc_avg != i_out_adc_notified || v_in_adc_avg != v_in_adc_notified || v_out_adc_avg != v_out_adc_notified)) {
+            i_out_adc_notified = i_out_adc_avg;
+            v_in_adc_notified  = v_in_adc_avg;
+            v_out_adc_notified = v_out_adc_avg;
+            measurement_pending = event_put(event_measurement, 0);
+        }
     }
-
-#ifdef CONFIG_FUNCGEN_ENABLE
-    (*funcgen_tick)();
-#endif
 }
 
 /**
@@ -425,7 +517,12 @@ void usart1_isr(void)
     if (((USART_CR1(USART1) & USART_CR1_RXNEIE) != 0) &&
         ((USART_SR(USART1) & USART_SR_RXNE) != 0)) {
         uint8_t ch = usart_recv(USART1);
+#ifdef CONFIG_COMMANDLINE
         event_put(event_uart_rx, ch);
+#else // CONFIG_COMMANDLINE
+        /** Only complete frames are posted to the main loop */
+        rxframe_put_char(ch);
+#endif // CONFIG_COMMANDLINE
     }
 
 #ifdef TX_IRQ
@@ -809,38 +906,62 @@ static void tim2_init(void)
 
 #ifdef CONFIG_FUNCGEN_ENABLE
 /**
-  * @brief Set up TIM3 for function generator sampling
-  * This timer fires at 1000000Hz (that is 48MHz / 1 / 48) 
+  * @brief Set up TIM6 for pacing the function generator samples, it is
+  *        started by hw_dds_start(...)
   * @retval None
   */
-static void tim3_init(void)
+static void tim6_init(void)
 {
-    uint32_t timer = TIM3;
-    common_timer_init(RCC_TIM3, timer, 0xFFFF, 47);
-    timer_enable_counter(timer);
-    nvic_enable_irq(NVIC_TIM3_IRQ);
-    nvic_set_priority(NVIC_TIM3_IRQ, 1);
-    timer_enable_irq(timer, TIM_DIER_UIE); /* Update IRQ enable */
+    uint32_t timer = TIM6;
+    common_timer_init(RCC_TIM6, timer, 0xFFFF, 0);
+    timer_set_master_mode(timer, TIM_CR2_MMS_UPDATE); // Generate TRGO on every update, triggers the DAC
+    /** The value line has no DMA2, the DAC channel 1 request must be
+        remapped to DMA1 channel 3. AFIO is clocked by clock_init(). */
+    AFIO_MAPR2 |= AFIO_MAPR2_TIM67_DAC_DMA_REMAP;
 }
 
-void tim3_isr(void) {
-  if (timer_get_flag(TIM3, TIM_DIER_UIE)) {
-      timer_clear_flag(TIM3, TIM_DIER_UIE);
-  }
-  cur_time_hiw ++;
-}
-
-uint32_t cur_time_us(void)
+/**
+  * @brief Feed the voltage DAC from a circular DMA buffer, one sample for
+  *        each TIM6 update
+  * @param buffer DAC values, must be kept until hw_dds_stop() is called
+  * @param length number of samples in the buffer
+  * @param prescaler TIM6 prescaler - 1
+  * @param period TIM6 period - 1
+  * @retval None
+  */
+void hw_dds_start(const uint16_t *buffer, uint32_t length, uint32_t prescaler, uint32_t period)
 {
-    uint32_t t = timer_get_counter(TIM3);
-    t |= (cur_time_hiw << 16U);
-    return t;
+    hw_dds_stop();
+    timer_set_prescaler(TIM6, prescaler);
+    timer_set_period(TIM6, period);
+    timer_set_counter(TIM6, 0);
+
+    /** DAC channel 1 requests are served by DMA1 channel 3 */
+    dma_channel_reset(DMA1, DMA_CHANNEL3);
+    dma_set_peripheral_address(DMA1, DMA_CHANNEL3, (uint32_t) &DAC_DHR12R1(DAC1));
+    dma_set_memory_address(DMA1, DMA_CHANNEL3, (uint32_t) buffer);
+    dma_set_number_of_data(DMA1, DMA_CHANNEL3, length);
+    dma_set_read_from_memory(DMA1, DMA_CHANNEL3);
+    dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL3);
+    dma_enable_circular_mode(DMA1, DMA_CHANNEL3);
+    dma_set_peripheral_size(DMA1, DMA_CHANNEL3, DMA_CCR_PSIZE_16BIT);
+    dma_set_memory_size(DMA1, DMA_CHANNEL3, DMA_CCR_MSIZE_16BIT);
+    dma_set_priority(DMA1, DMA_CHANNEL3, DMA_CCR_PL_HIGH);
+    dma_enable_channel(DMA1, DMA_CHANNEL3);
+
+    DAC_CR(DAC1) |= 0x00001004; // DMAEN1, TSEL1 = TIM6 TRGO, TEN1
+    timer_enable_counter(TIM6);
 }
+
 /**
-  * @brief Do nothing
-  * This avoid to test a (shared) variable and branch in an isr, and instead, branch to a function in all cases
+  * @brief Stop feeding the voltage DAC, it is written directly again
+  * @retval None
   */
-void fg_noop(void) {
+void hw_dds_stop(void)
+{
+    timer_disable_counter(TIM6);
+    DAC_CR(DAC1) &= ~0x0000103c; // DMAEN1, TSEL1, TEN1
+    dma_disable_channel(DMA1, DMA_CHANNEL3);
 }
 #endif
 
@@ -853,7 +974,7 @@ static void longpress_begin(event_t event)
 {
     longpress_event = event;
     longpress_detected = false;
-    longpress_start = get_ticks();
+    swtimer_start(&longpress_timer, LONGPRESS_TIME_MS, 0);
 }
 
 /**
@@ -863,8 +984,8 @@ static void longpress_begin(event_t event)
 static bool longpress_end(void)
 {
     bool temp = longpress_detected;
+    swtimer_stop(&longpress_timer);
     longpress_event = event_none;
-    longpress_start = 0;
     longpress_detected = false;
     return temp;
 }
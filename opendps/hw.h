@@ -94,6 +94,13 @@ void hw_init(void);
   */
 void hw_get_adc_values(uint16_t *i_out_raw, uint16_t *v_in_raw, uint16_t *v_out_raw);
 
+/**
+  * @brief Acknowledge an event_measurement, the next change of the averaged
+  *        ADC values will be notified
+  * @retval none
+  */
+void hw_ack_measurement(void);
+
 /**
   * @brief Set the output voltage DAC value
   * @param v_dac the value to set to
@@ -139,10 +146,21 @@ uint16_t hw_get_itrig_ma(void);
 uint16_t hw_get_vtrig_mv(void);
 
 /**
-  * @brief Check if it current press is a long press, inject event if so
+  * @brief Sleep until the next interrupt unless an event is pending, the 1ms
+  *        systick bounds the sleep so the software timers stay on time
+  * @retval None
+  */
+void hw_idle(void);
+
+/**
+  * @brief Get the CPU load of the last second
+  * @param idle (out) time spent sleeping in hw_idle() in 0.1%
+  * @param max_busy (out) the longest time between two sleeps in us, events
+  *        arriving while the CPU is awake wait at most this long
+  * @param wakeups (out) number of wakeups per second
   * @retval None
   */
-void hw_longpress_check(void);
+void hw_get_load(uint16_t *idle, uint32_t *max_busy, uint32_t *wakeups);
 
 /**
   * @brief Check if SEL button is pressed
@@ -167,20 +185,21 @@ void hw_print_ticks(void);
 
 #ifdef CONFIG_FUNCGEN_ENABLE
 /**
-  * @brief A pointer to the function generator's that's called upon each ADC update
-  * @retval none
+  * @brief Feed the voltage DAC from a circular DMA buffer, one sample for
+  *        each TIM6 update
+  * @param buffer DAC values, must be kept until hw_dds_stop() is called
+  * @param length number of samples in the buffer
+  * @param prescaler TIM6 prescaler - 1
+  * @param period TIM6 period - 1
+  * @retval None
   */
-extern void (*funcgen_tick)(void);
-/** 
-  * @brief An empty function. This is used to avoid testing in the ISR and branch in all cases (fixed latency)
-  * @retval none
-  */  
-void fg_noop(void);
+void hw_dds_start(const uint16_t *buffer, uint32_t length, uint32_t prescaler, uint32_t period);
 
 /**
-  * @brief The current time in microsecond unit, updated by a timer
+  * @brief Stop feeding the voltage DAC, it is written directly again
+  * @retval None
   */
-uint32_t cur_time_us(void); 
+void hw_dds_stop(void);
 #endif
 
 #endif // __HW_H__
@@ -37,6 +37,12 @@ static uint8_t colorspace_data;
 static int16_t screen_width, screen_height;
 static uint8_t rotation;
 
+/** Display commands packed for spi_dma_queue_commands */
+typedef struct {
+    uint8_t buf[SPI_DMA_INLINE_SIZE];
+    uint8_t len;
+} cmd_list_t;
+
 static void chip_init(void);
 static void write_command(uint8_t c);
 static void write_data(uint8_t c);
@@ -88,23 +94,101 @@ void ili9163c_get_geometry(uint16_t *width, uint16_t *height)
 
 static void write_command(uint8_t c)
 {
-    gpio_clear(TFT_A0_PORT, TFT_A0_PIN);
-    uint8_t tx_buf[1] = {c};
-    (void) spi_dma_transceive((uint8_t*) tx_buf, sizeof(tx_buf), 0, 0);
+    (void) spi_dma_queue_copy(&c, sizeof(c), 1, false);
 }
 
 static void write_data(uint8_t c)
 {
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    uint8_t tx_buf[1] = {c};
-    (void) spi_dma_transceive((uint8_t*) tx_buf, sizeof(tx_buf), 0, 0);
+    (void) spi_dma_queue_copy(&c, sizeof(c), 1, true);
 }
 
 static void write_data16(uint16_t d)
 {
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
     uint8_t tx_buf[2] = {(uint8_t) (d >> 8), (uint8_t) (d & 0xff)};
-    (void) spi_dma_transceive((uint8_t*) tx_buf, sizeof(tx_buf), 0, 0);
+    (void) spi_dma_queue_copy(tx_buf, sizeof(tx_buf), 1, true);
+}
+
+/**
+  * @brief Add a command and its arguments to a command list
+  * @param list the command list
+  * @param cmd the command
+  * @param data command arguments (may be NULL)
+  * @param len number of command arguments
+  * @retval None
+  */
+static void cmd_list_add(cmd_list_t *list, uint8_t cmd, const uint8_t *data, uint8_t len)
+{
+    if ((uint32_t) list->len + 2 + len > sizeof(list->buf)) {
+        return;
+    }
+    list->buf[list->len++] = cmd;
+    list->buf[list->len++] = len;
+    while (len--) {
+        list->buf[list->len++] = *data++;
+    }
+}
+
+/**
+  * @brief Add a column or page address command to a command list
+  * @param list the command list
+  * @param cmd CMD_CLMADRS or CMD_PGEADRS
+  * @param start first column/page
+  * @param end last column/page
+  * @retval None
+  */
+static void cmd_list_add_window(cmd_list_t *list, uint8_t cmd, uint16_t start, uint16_t end)
+{
+    uint8_t data[4] = {(uint8_t) (start >> 8), (uint8_t) (start & 0xff), (uint8_t) (end >> 8), (uint8_t) (end & 0xff)};
+    cmd_list_add(list, cmd, data, sizeof(data));
+}
+
+/**
+  * @brief Queue a single color for a number of pixels
+  * @param color the color
+  * @param count number of pixels
+  * @retval None
+  */
+void ili9163c_push_colors(uint16_t color, uint32_t count)
+{
+    while (count) {
+        uint32_t chunk = count > 0xffff ? 0xffff : count;
+        (void) spi_dma_queue_fill(color, chunk, true);
+        count -= chunk;
+    }
+}
+
+/**
+  * @brief Queue pixels in native byte order, the data is sent in the background
+  * @param pixels pixel data, must remain valid until the transfer is done
+  * @param count number of pixels
+  * @retval None
+  */
+void ili9163c_push_pixels(const uint16_t *pixels, uint32_t count)
+{
+    while (count) {
+        uint32_t chunk = count > 0xffff ? 0xffff : count;
+        (void) spi_dma_queue16(pixels, chunk, true);
+        pixels += chunk;
+        count -= chunk;
+    }
+}
+
+/**
+  * @brief Queue pixels stored as big endian bytes (as in the generated
+  *        graphics), the data is sent in the background
+  * @param data pixel data, must remain valid until the transfer is done
+  * @param count number of pixels
+  * @retval None
+  */
+void ili9163c_push_bytes(const uint8_t *data, uint32_t count)
+{
+    uint32_t len = 2 * count;
+    while (len) {
+        uint32_t chunk = len > 0x8000 ? 0x8000 : len;
+        (void) spi_dma_queue(data, chunk, 1, true);
+        data += chunk;
+        len -= chunk;
+    }
 }
 
 static void chip_init(void)
@@ -112,6 +196,7 @@ static void chip_init(void)
     uint8_t i;
 
     write_command(CMD_SWRESET); // software reset
+    spi_dma_fence();
     delay_ms(1);
 
     write_command(CMD_SLPOUT); // exit sleep
@@ -208,20 +293,18 @@ void ili9163c_draw_vline(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
     if (ili9163c_boundary_check(x,y)) return;
     if (((y + h) - 1) >= screen_height) h = screen_height-y;
+    if (h <= 0) return;
     ili9163c_set_window(x,y,x,(y+h)-1);
-    while (h-- > 0) {
-        write_data16(color);
-    }
+    ili9163c_push_colors(color, h);
 }
 
 void ili9163c_draw_hline(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
     if (ili9163c_boundary_check(x,y)) return;
     if (((x+w) - 1) >= screen_width) w = screen_width-x;
+    if (w <= 0) return;
     ili9163c_set_window(x,y,(x+w)-1,y);
-    while (w-- > 0) {
-        write_data16(color);
-    }
+    ili9163c_push_colors(color, w);
 }
 
 bool ili9163c_boundary_check(int16_t x,int16_t y)
@@ -232,17 +315,8 @@ bool ili9163c_boundary_check(int16_t x,int16_t y)
 
 void ili9163c_fill_screen(uint16_t color)
 {
-    uint32_t i;
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xff;
-    uint8_t fill[] = {hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo};
-    uint8_t dummy[sizeof(fill)];
-    gpio_clear(TFT_A0_PORT, TFT_A0_PIN);
     ili9163c_set_window(0, 0, _GRAMWIDTH+2, _GRAMHEIGH); // Note! For some reason filling WxH is results in two vertical lines to the far right...
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    for (i = 0;i < ((_GRAMWIDTH+2) * _GRAMHEIGH)/(sizeof(fill)/2); i++) {
-        (void) spi_dma_transceive((uint8_t*) fill, sizeof(fill), (uint8_t*) dummy, sizeof(dummy));
-    }
+    ili9163c_push_colors(color, (_GRAMWIDTH+2) * _GRAMHEIGH);
 }
 
 // fill a rectangle
@@ -251,63 +325,51 @@ void ili9163c_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t col
     if (ili9163c_boundary_check(x,y)) return;
     if (((x + w) - 1) >= screen_width)  w = screen_width  - x;
     if (((y + h) - 1) >= screen_height) h = screen_height - y;
+    if (w <= 0 || h <= 0) return;
     ili9163c_set_window(x,y,(x+w)-1,(y+h)-1);
-    for (y = h;y > 0;y--) {
-        for (x = w;x > 1;x--) {
-            write_data16(color);
-        }
-        write_data16(color);
-    }
+    ili9163c_push_colors(color, w * h);
 }
 
 void ili9163c_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-    write_command(CMD_CLMADRS); // Column
-    if (rotation == 3)
-    {
-        write_data16(x0 + 3);
-        write_data16(x1 + 3);
-    }
-    else if (rotation == 2)
-    {
-        write_data16(x0 + 2);
-        write_data16(x1 + 2);
-    }
-    else if (rotation == 1)
-    {
-        write_data16(x0 + 1);
-        write_data16(x1 + 1);
-    }
-    else
-    {
-        write_data16(x0 + 2);
-        write_data16(x1 + 2);
+    uint16_t x_offset, y_offset;
+    cmd_list_t list = { .len = 0 };
+
+    if (rotation == 3) {
+        x_offset = 3;
+        y_offset = 2;
+    } else if (rotation == 2) {
+        x_offset = 2;
+        y_offset = 3;
+    } else if (rotation == 1) {
+        x_offset = 1;
+        y_offset = 2;
+    } else {
+        x_offset = 2;
+        y_offset = 1;
     }
 
-    write_command(CMD_PGEADRS); // Page
-    if (rotation == 3)
-    {
-        write_data16(y0 + 2);
-        write_data16(y1 + 2);
-    }
-    else if (rotation == 2)
-    {
-        write_data16(y0 + 3);
-        write_data16(y1 + 3);
-    }
-    else if (rotation == 1)
-    {
-        write_data16(y0 + 2);
-        write_data16(y1 + 2);
-    }
-    else
-    {
-        write_data16(y0 + 1);
-        write_data16(y1 + 1);
-    }
-    write_command(CMD_RAMWR); // Into RAM
+    cmd_list_add_window(&list, CMD_CLMADRS, x0 + x_offset, x1 + x_offset); // Column
+    cmd_list_add_window(&list, CMD_PGEADRS, y0 + y_offset, y1 + y_offset); // Page
+    cmd_list_add(&list, CMD_RAMWR, 0, 0); // Into RAM
+    (void) spi_dma_queue_commands(list.buf, list.len);
 }
 
+/**
+  * @brief Set the vertical scroll start address, relative to the scroll area
+  *        set up in chip_init(). GRAM lines scrolled out of one end of the
+  *        area come back in at the other.
+  * @param lines number of lines to scroll
+  * @retval None
+  */
+void ili9163c_set_scroll(uint16_t lines)
+{
+    uint16_t start = __OFFSET + lines % (_GRAMHEIGH - __OFFSET);
+    uint8_t data[2] = {(uint8_t) (start >> 8), (uint8_t) (start & 0xff)};
+    cmd_list_t list = { .len = 0 };
+    cmd_list_add(&list, CMD_VSSTADRS, data, sizeof(data));
+    (void) spi_dma_queue_commands(list.buf, list.len);
+}
 
 void ili9163c_set_rotation(uint8_t m)
 {
@@ -335,8 +397,9 @@ void ili9163c_set_rotation(uint8_t m)
         break;
     }
     color_space(colorspace_data);
-    write_command(CMD_MADCTL);
-    write_data(mad_ctrl_value);
+    cmd_list_t list = { .len = 0 };
+    cmd_list_add(&list, CMD_MADCTL, &mad_ctrl_value, 1);
+    (void) spi_dma_queue_commands(list.buf, list.len);
 }
 
 /*
@@ -54,10 +54,14 @@ void ili9163c_init(void);
 void ili9163c_get_geometry(uint16_t *width, uint16_t *height);
 void ili9163c_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void ili9163c_push_color(uint16_t color);
+void ili9163c_push_colors(uint16_t color, uint32_t count);
+void ili9163c_push_pixels(const uint16_t *pixels, uint32_t count);
+void ili9163c_push_bytes(const uint8_t *data, uint32_t count);
 void ili9163c_fill_screen(uint16_t color);
 void ili9163c_draw_pixel(int16_t x, int16_t y, uint16_t color);
 void ili9163c_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t color);
 void ili9163c_set_rotation(uint8_t r);
+void ili9163c_set_scroll(uint16_t lines);
 void ili9163c_invert_display(bool i);
 void ili9163c_display(bool on);
 bool ili9163c_boundary_check(int16_t x,int16_t y);
@@ -33,6 +33,7 @@
 #include <timer.h>
 #include "dbg_printf.h"
 #include "tick.h"
+#include "swtimer.h"
 #include "tft.h"
 #include "event.h"
 #include "hw.h"
@@ -79,20 +80,33 @@
 #ifdef CONFIG_FUNCGEN_ENABLE
 #include "func_gen.h"
 #endif // CONFIG_FUNCGEN_ENABLE
+#ifdef CONFIG_SEQUENCE_ENABLE
+#include "func_seq.h"
+#endif // CONFIG_SEQUENCE_ENABLE
+#ifdef CONFIG_HISTORY
+#include "history.h"
+#endif // CONFIG_HISTORY
+#ifdef CONFIG_CHART
+#include "settings_chart.h"
+#endif // CONFIG_CHART
+#ifdef CONFIG_PROFILE
+#include "profile.h"
+#endif // CONFIG_PROFILE
 
 #ifdef DPS_EMULATOR
 #include "dpsemul.h"
 #endif // DPS_EMULATOR
 
 #ifdef CONFIG_SPLASH_SCREEN
-#include "logo.h"
+#include "gfx-logo.h"
 #endif // CONFIG_SPLASH_SCREEN
 
 #define TFT_HEIGHT  (128)
 #define TFT_WIDTH   (128)
 
-/** How ofter we update the measurements in the UI (ms) */
-#define UI_UPDATE_INTERVAL_MS  (250)
+/** The screens are updated on new measurements and user input, and also at
+    this interval to catch changes made in other ways */
+#define UI_FALLBACK_INTERVAL_MS  (1000)
 
 /** Timeout for waiting for network connection (ms) */
 #define NETWORK_CONNECT_TIMEOUT  (10000)
@@ -101,6 +115,28 @@
 #define GFX_NETWORK_WIDTH 19
 #define GFX_NETWORK_HEIGHT 16
 
+#ifdef CONFIG_NETWORK_ETHERNET
+#define GFX_NETWORK gfx_ethernet
+#else
+#define GFX_NETWORK gfx_wifi
+#endif
+
+#ifdef CONFIG_POWER_COLORED
+#define GFX_POWER_ON gfx_poweron
+#ifdef CONFIG_POWER_OFF_VISIBLE
+#define GFX_POWER_OFF gfx_poweroff
+#else
+#define GFX_POWER_OFF NULL
+#endif
+#else
+#define GFX_POWER_ON gfx_power
+#define GFX_POWER_OFF NULL
+#endif
+
+/** All power icons share the same size */
+#define GFX_POWER_ICON_WIDTH  (16)
+#define GFX_POWER_ICON_HEIGHT (16)
+
 /** Blit positions */
 #define XPOS_NETWORK_STATUS     (4)
 #define XPOS_LOCK    (27)
@@ -116,25 +152,38 @@
 #define TFT_FLASHING_COUNTER                (2)
 
 static void ui_flash(void);
+static void ui_update(void);
 static void read_past_settings(void);
 static void write_past_settings(void);
 static void check_master_reset(void);
+static void draw_status_icons(void);
 
 /** UI settings */
 static uint16_t bg_color;
 static uint32_t ui_width;
 static uint32_t ui_height;
 
+/** Restarted on every screen update */
+static void ui_fallback_fired(swtimer_t *timer);
+static swtimer_t ui_fallback_timer = { .callback = &ui_fallback_fired };
+
 /** Used to make the screen flash */
-static uint32_t tft_flashing_period;
+static void tft_flash_fired(swtimer_t *timer);
+static swtimer_t tft_flash_timer = { .callback = &tft_flash_fired };
 static uint32_t tft_flash_counter;
 
 /** Used for flashing the network icon */
-static uint32_t network_status_flashing_period;
-static bool network_status_visible;
+static void network_flash_fired(swtimer_t *timer);
+static swtimer_t network_flash_timer = { .callback = &network_flash_fired };
+static const uint16_t *network_icon; /** NULL when hidden */
+
+/** Running while waiting for the network to connect */
+static void network_timeout_fired(swtimer_t *timer);
+static swtimer_t network_timeout_timer = { .callback = &network_timeout_fired };
 
 /** Used for flashing the lock icon */
-static uint32_t lock_flashing_period;
+static void lock_flash_fired(swtimer_t *timer);
+static swtimer_t lock_flash_timer = { .callback = &lock_flash_fired };
 static bool lock_visible;
 static uint32_t lock_flash_counter;
 
@@ -144,6 +193,11 @@ static bool is_locked;
 static bool is_temperature_locked;
 static bool is_enabled;
 
+/** What is currently on screen at each status icon position */
+static tft_icon_spot_t network_spot;
+static tft_icon_spot_t lock_spot;
+static tft_icon_spot_t power_spot;
+
 /** Last settings written to past */
 static bool     last_tft_inv_setting;
 
@@ -172,6 +226,12 @@ static past_t g_past = {
     .blocks = {0x0800f800, 0x0800fc00}
 };
 
+#ifdef CONFIG_HISTORY
+/** Linker file symbols for the measurement history area */
+extern uint32_t *_history_start;
+extern uint32_t *_history_end;
+#endif // CONFIG_HISTORY
+
 /** The function UI displaying the current active function */
 #define FUNC_UI_ID (0)
 static uui_t func_ui;
@@ -397,23 +457,27 @@ bool opendps_clear_calibration(void)
 }
 
 /**
- * @brief      Enable output of current function
+ * @brief      Enable output of current function. The output is switched
+ *             before returning, without going through the event queue.
  *
  * @param[in]  enable  Enable or disable
  *
- * @return     True if enable was successul
+ * @return     True if the output is in the requested state
  */
 bool opendps_enable_output(bool enable)
 {
-    if (!is_temperature_locked && current_ui->screens[current_ui->cur_screen]->enable) {
-        if (current_ui->screens[current_ui->cur_screen]->is_enabled != enable) {
-            event_put(event_button_enable, press_short); /** @todo: call directly as this will not work for temperature alarm */
-        }
-    } else {
+    if (is_temperature_locked || !current_ui->screens[current_ui->cur_screen]->enable) {
         emu_printf("Output enable failed %s\n", is_temperature_locked ? "due to high temperature" : "");
         return false;
     }
-    return true;
+    if (current_ui->screens[current_ui->cur_screen]->is_enabled != enable) {
+        /** Same as pressing the enable button */
+        write_past_settings();
+        (void) uui_enable_cur_screen(current_ui, enable);
+        uui_refresh(current_ui, false);
+        ui_update();
+    }
+    return pwrctl_vout_enabled() == enable;
 }
 
 bool opendps_enable_function_idx(uint32_t index)
@@ -431,17 +495,55 @@ bool opendps_enable_function_idx(uint32_t index)
  */
 static void main_ui_tick(void)
 {
+    if (!main_ui.is_visible) {
+        return;
+    }
+
     uint16_t i_out_raw, v_in_raw, v_out_raw;
     hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
     (void) i_out_raw;
     (void) v_out_raw;
 
     // update input voltage value
-    input_voltage.value = pwrctl_calc_vin(v_in_raw);
-    input_voltage.ui.draw(&input_voltage.ui);
+    (void) number_update(&input_voltage, pwrctl_calc_vin(v_in_raw));
 
-    // Update power button
-    opendps_update_power_status(is_enabled);
+    // Redraw status icons that changed or were overwritten
+    draw_status_icons();
+}
+
+/**
+  * @brief Draw a status bar icon unless it is already on screen
+  * @param spot what was last drawn at this position
+  * @param icon the icon to show, NULL to blank the position
+  * @param width icon width
+  * @param height icon height
+  * @param x icon position, icons are bottom aligned
+  * @retval none
+  */
+static void draw_status_icon(tft_icon_spot_t *spot, const uint16_t *icon, uint32_t width, uint32_t height, uint32_t x)
+{
+    if (tft_icon_changed(spot, icon)) {
+        if (icon) {
+            tft_blit_rle(icon, width, height, x, ui_height-height);
+        } else {
+            tft_fill(x, ui_height-height, width, height, bg_color);
+        }
+    }
+}
+
+/**
+  * @brief Bring the network, lock and power icons up to date. Only icons
+  *        whose state changed or which were overwritten are sent.
+  * @retval none
+  */
+static void draw_status_icons(void)
+{
+    if (!main_ui.is_visible) {
+        return;
+    }
+    draw_status_icon(&network_spot, network_icon, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS);
+    draw_status_icon(&lock_spot, lock_visible ? gfx_padlock : NULL, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, XPOS_LOCK);
+    draw_status_icon(&power_spot, is_enabled ? GFX_POWER_ON : GFX_POWER_OFF, GFX_POWER_ICON_WIDTH, GFX_POWER_ICON_HEIGHT, ui_width-GFX_POWER_ICON_WIDTH);
 }
 
 /**
@@ -468,11 +570,17 @@ static void ui_init(void)
 #ifdef CONFIG_FUNCGEN_ENABLE
     func_gen_init(&func_ui);
 #endif // CONFIG_FUNCGEN_ENABLE
+#ifdef CONFIG_SEQUENCE_ENABLE
+    func_seq_init(&func_ui);
+#endif // CONFIG_SEQUENCE_ENABLE
 
 
     /** Initialise the settings screens */
     uui_init(&settings_ui, &g_past);
     settings_calibration_init(&settings_ui);
+#ifdef CONFIG_CHART
+    settings_chart_init(&settings_ui);
+#endif // CONFIG_CHART
 
     /** Initialise the main screens */
     uui_init(&main_ui, &g_past);
@@ -515,7 +623,10 @@ static void ui_handle_event(event_t event, uint8_t data)
             case event_rot_left:
             case event_rot_right:
             case event_button_enable:
-                lock_flashing_period = LOCK_FLASHING_PERIOD;
+                /** Hammering the buttons keeps the lock flashing */
+                if (lock_flash_counter == 0) {
+                    swtimer_start(&lock_flash_timer, LOCK_FLASHING_PERIOD, LOCK_FLASHING_PERIOD);
+                }
                 lock_flash_counter = LOCK_FLASHING_COUNTER;
                 return;
             default:
@@ -572,6 +683,11 @@ static void ui_handle_event(event_t event, uint8_t data)
         case event_rot_right_set:
             uui_handle_screen_event(current_ui, event);
             uui_refresh(current_ui, false);
+            /** Show the setting or measurement the input may have switched to */
+            ui_update();
+            break;
+        case event_measurement:
+            ui_update();
             break;
         default:
             break;
@@ -587,14 +703,10 @@ void opendps_lock(bool lock)
 {
     if (is_locked != lock) {
         is_locked = lock;
-        lock_flashing_period = 0;
-        if (is_locked) {
-            lock_visible = true;
-            tft_blit((uint16_t*) gfx_padlock, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, XPOS_LOCK, ui_height-GFX_PADLOCK_HEIGHT);
-        } else {
-            lock_visible = false;
-            tft_fill(XPOS_LOCK, ui_height-GFX_PADLOCK_HEIGHT, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, bg_color);
-        }
+        swtimer_stop(&lock_flash_timer);
+        lock_flash_counter = 0;
+        lock_visible = is_locked;
+        draw_status_icons();
     }
 }
 
@@ -610,12 +722,11 @@ void opendps_temperature_lock(bool lock)
         is_temperature_locked = lock;
         if (is_temperature_locked) {
             emu_printf("DPS disabled due to temperature\n");
-            /** @todo Right now we cannot use opendps_enable_output here */
-            uui_disable_cur_screen(current_ui);
+            (void) uui_enable_cur_screen(current_ui, false);
             tft_clear();
             uui_show(current_ui, false);
             uui_show(&main_ui, false);
-            tft_blit((uint16_t*) gfx_thermometer, GFX_THERMOMETER_WIDTH, GFX_THERMOMETER_HEIGHT, 1+(ui_width-GFX_THERMOMETER_WIDTH)/2, 30);
+            tft_blit_rle(gfx_thermometer, GFX_THERMOMETER_WIDTH, GFX_THERMOMETER_HEIGHT, 1+(ui_width-GFX_THERMOMETER_WIDTH)/2, 30);
         } else {
             emu_printf("DPS enabled due to temperature\n");
             tft_clear();
@@ -629,79 +740,85 @@ void opendps_temperature_lock(bool lock)
 #endif // CONFIG_THERMAL_LOCKOUT
 
 /**
-  * @brief Do periodical updates in the UI
+  * @brief Update the screens with the latest measurements and settings
   * @retval none
   */
-static void ui_tick(void)
+static void ui_update(void)
 {
-    static uint64_t last_network_update = 0;
-    static uint64_t last_tft_flash = 0;
-    static uint64_t last_lock_flash = 0;
-
-    static uint64_t last = 0;
-    /** Update on the first call and every UI_UPDATE_INTERVAL_MS ms */
-    if (last > 0 && get_ticks() - last < UI_UPDATE_INTERVAL_MS) {
-        return;
+    /** Full screen screens hide the main UI */
+    bool show_main_ui = !current_ui->screens[current_ui->cur_screen]->is_fullscreen && !is_temperature_locked;
+    if (main_ui.is_visible != show_main_ui) {
+        uui_show(&main_ui, show_main_ui);
     }
 
-    last = get_ticks();
+    swtimer_start(&ui_fallback_timer, UI_FALLBACK_INTERVAL_MS, 0);
     uui_tick(current_ui);
     uui_tick(&main_ui);
+}
 
-#ifndef CONFIG_SPLASH_SCREEN
-    {
-        // Light up the display now that the UI has been drawn
-        static bool first = true;
-        if (first) {
-            hw_enable_backlight(last_tft_brightness);
-            first = false;
-        }
-    }
-#endif // CONFIG_SPLASH_SCREEN
+/**
+  * @brief Update the screens when nothing else has for a while
+  * @param timer the fallback timer
+  * @retval none
+  */
+static void ui_fallback_fired(swtimer_t *timer)
+{
+    (void) timer;
+    ui_update();
+}
 
-    if (network_status_flashing_period > 0 && get_ticks() - last_network_update > network_status_flashing_period) {
-        last_network_update = get_ticks();
-        if (network_status_visible) {
-            tft_fill(XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, bg_color);
-        } else {
-#ifdef CONFIG_NETWORK_ETHERNET
-	        tft_blit((uint16_t*) gfx_ethernet, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
-#else
-		tft_blit((uint16_t*) gfx_wifi, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
-#endif
-        }
-        network_status_visible = !network_status_visible;
-    }
+/**
+  * @brief Toggle the network icon
+  * @param timer the network flash timer
+  * @retval none
+  */
+static void network_flash_fired(swtimer_t *timer)
+{
+    (void) timer;
+    network_icon = network_icon ? NULL : GFX_NETWORK;
+    draw_status_icons();
+}
 
-    if (lock_flashing_period > 0 && get_ticks() - last_lock_flash > lock_flashing_period) {
-        last_lock_flash = get_ticks();
-        lock_visible = !lock_visible;
-        if (lock_visible) {
-            tft_blit((uint16_t*) gfx_padlock, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, XPOS_LOCK, ui_height-GFX_PADLOCK_HEIGHT);
-        } else {
-            tft_fill(XPOS_LOCK, ui_height-GFX_PADLOCK_HEIGHT, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, bg_color);
-        }
-        lock_flash_counter--;
-        if (lock_flash_counter == 0) {
-            lock_visible = true;
-            /** If the user hammers the locked buttons we might end up with an
-                invisible locking symbol at the end of the flashing */
-            tft_blit((uint16_t*) gfx_padlock, GFX_PADLOCK_WIDTH, GFX_PADLOCK_HEIGHT, XPOS_LOCK, ui_height-GFX_PADLOCK_HEIGHT);
-            lock_flashing_period = 0;
-        }
-    }
+/**
+  * @brief Give up waiting for the network to connect
+  * @param timer the network timeout timer
+  * @retval none
+  */
+static void network_timeout_fired(swtimer_t *timer)
+{
+    (void) timer;
+    opendps_update_network_status(network_off);
+}
 
-    if (tft_flashing_period > 0 && get_ticks() - last_tft_flash > tft_flashing_period) {
-        last_tft_flash = get_ticks();
-        tft_flash_counter--;
-        tft_invert(!tft_is_inverted());
-        if (tft_flash_counter == 0) {
-            tft_flashing_period = 0;
-        }
+/**
+  * @brief Toggle the lock icon until the flash counter runs out
+  * @param timer the lock flash timer
+  * @retval none
+  */
+static void lock_flash_fired(swtimer_t *timer)
+{
+    lock_visible = !lock_visible;
+    lock_flash_counter--;
+    if (lock_flash_counter == 0) {
+        /** If the user hammers the locked buttons we might end up with an
+            invisible locking symbol at the end of the flashing */
+        lock_visible = true;
+        swtimer_stop(timer);
     }
+    draw_status_icons();
+}
 
-    if ((network_status == wifi_connecting || network_status == ethernet_connecting) && get_ticks() > NETWORK_CONNECT_TIMEOUT) {
-        opendps_update_network_status(network_off);
+/**
+  * @brief Invert the TFT until the flash counter runs out
+  * @param timer the TFT flash timer
+  * @retval none
+  */
+static void tft_flash_fired(swtimer_t *timer)
+{
+    tft_flash_counter--;
+    tft_invert(!tft_is_inverted());
+    if (tft_flash_counter == 0) {
+        swtimer_stop(timer);
     }
 }
 
@@ -722,40 +839,48 @@ void opendps_handle_ping(void)
 void opendps_update_network_status(network_status_t status)
 {
     if (network_status != status) {
+        uint32_t flashing_period = 0;
         network_status = status;
         switch(network_status) {
             case network_off:
-                network_status_flashing_period = 0;
-                network_status_visible = true;
-                tft_fill(XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, bg_color);
+                network_icon = NULL;
                 break;
             case wifi_connecting:
-                network_status_flashing_period = NETWORK_CONNECTING_FLASHING_PERIOD;
-		tft_blit((uint16_t*) gfx_wifi, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
+                flashing_period = NETWORK_CONNECTING_FLASHING_PERIOD;
+                network_icon = gfx_wifi;
                 break;
             case wifi_connected:
-                network_status_flashing_period = 0;
-                network_status_visible = false;
-                tft_blit((uint16_t*) gfx_wifi, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
+                network_icon = gfx_wifi;
                 break;
 	    case ethernet_connecting:
-                network_status_flashing_period = NETWORK_CONNECTING_FLASHING_PERIOD;
-                tft_blit((uint16_t*) gfx_ethernet, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
+                flashing_period = NETWORK_CONNECTING_FLASHING_PERIOD;
+                network_icon = gfx_ethernet;
                 break;
 	    case ethernet_connected:
-		network_status_flashing_period = 0;
-		network_status_visible = false;
-		tft_blit((uint16_t*) gfx_ethernet, GFX_NETWORK_WIDTH, GFX_NETWORK_HEIGHT, XPOS_NETWORK_STATUS, ui_height-GFX_NETWORK_HEIGHT);
+		network_icon = gfx_ethernet;
 		break;
             case ethernet_error:
 	    case wifi_error:
-                network_status_flashing_period = NETWORK_ERROR_FLASHING_PERIOD;
+                flashing_period = NETWORK_ERROR_FLASHING_PERIOD;
                 break;
             case wifi_upgrading:
-                network_status_flashing_period = NETWORK_UPGRADING_FLASHING_PERIOD;
-		network_status_visible = false;
+                flashing_period = NETWORK_UPGRADING_FLASHING_PERIOD;
+                network_icon = NULL;
                 break;
         }
+        if (flashing_period) {
+            swtimer_start(&network_flash_timer, flashing_period, flashing_period);
+        } else {
+            swtimer_stop(&network_flash_timer);
+        }
+        if (network_status == wifi_connecting || network_status == ethernet_connecting) {
+            /** The timeout counts from boot */
+            uint64_t now = get_ticks();
+            swtimer_start(&network_timeout_timer, now < NETWORK_CONNECT_TIMEOUT ? NETWORK_CONNECT_TIMEOUT - now : 0, 0);
+        } else {
+            swtimer_stop(&network_timeout_timer);
+        }
+        draw_status_icons();
     }
 }
 /**
@@ -766,34 +891,7 @@ void opendps_update_network_status(network_status_t status)
 void opendps_update_power_status(bool enabled)
 {
     is_enabled = enabled;
-
-    if (is_enabled) {
-#ifdef CONFIG_POWER_COLORED
-        tft_blit((uint16_t*) gfx_poweron,
-                GFX_POWERON_WIDTH, GFX_POWERON_HEIGHT,
-                TFT_WIDTH-GFX_POWERON_WIDTH, TFT_HEIGHT-GFX_POWERON_HEIGHT);
-#else
-        tft_blit((uint16_t*) gfx_power,
-                GFX_POWER_WIDTH, GFX_POWER_HEIGHT,
-                TFT_WIDTH-GFX_POWER_WIDTH, TFT_HEIGHT-GFX_POWER_HEIGHT);
-#endif //CONFIG_POWER_COLORED
-
-    } else {
-// red poweroff button visible only if colored and off_visible are set
-#ifdef CONFIG_POWER_COLORED
-#ifdef CONFIG_POWER_OFF_VISIBLE
-        tft_blit((uint16_t*) gfx_poweroff,
-                GFX_POWEROFF_WIDTH, GFX_POWEROFF_HEIGHT,
-                TFT_WIDTH-GFX_POWEROFF_WIDTH, TFT_HEIGHT-GFX_POWEROFF_HEIGHT);
-#else //not CONFIG_POWER_OFF_VISIBLE
-        tft_fill(ui_width-GFX_POWERON_WIDTH, ui_height-GFX_POWERON_HEIGHT, GFX_POWERON_WIDTH, GFX_POWERON_HEIGHT, bg_color);
-#endif //CONFIG_POWER_OFF_VISIBLE
-
-#else //not CONFIG_POWER_COLORED
-        tft_fill(ui_width-GFX_POWER_WIDTH, ui_height-GFX_POWER_HEIGHT, GFX_POWER_WIDTH, GFX_POWER_HEIGHT, bg_color);
-#endif //CONFIG_POWER_COLORED
-
-    }
+    draw_status_icons();
 }
 
 #ifdef CONFIG_THERMAL_LOCKOUT
@@ -865,6 +963,19 @@ bool opendps_change_screen(uint8_t screen_id)
     return true;
 }
 
+/**
+ * @brief      Redraw the whole UI, eg. after something else has drawn on the
+ *             screen
+ */
+void opendps_redraw(void)
+{
+    tft_clear();
+    uui_activate(current_ui);
+    if (main_ui.is_visible) {
+        uui_refresh(&main_ui, true);
+    }
+}
+
 #ifdef CONFIG_SPLASH_SCREEN
 /**
   * @brief Draw splash screen
@@ -872,7 +983,7 @@ bool opendps_change_screen(uint8_t screen_id)
   */
 static void ui_draw_splash_screen(void)
 {
-    tft_blit((uint16_t*) logo, logo_width, logo_height, (ui_width-logo_width)/2, (ui_height-logo_height)/2);
+    tft_blit_rle(gfx_logo, GFX_LOGO_WIDTH, GFX_LOGO_HEIGHT, (ui_width-GFX_LOGO_WIDTH)/2, (ui_height-GFX_LOGO_HEIGHT)/2);
 }
 #endif // CONFIG_SPLASH_SCREEN
 
@@ -882,8 +993,11 @@ static void ui_draw_splash_screen(void)
   */
 static void ui_flash(void)
 {
-    tft_flashing_period = TFT_FLASHING_PERIOD;
-    tft_flash_counter = TFT_FLASHING_COUNTER;
+    /** A flash in progress is not restarted, that would leave the TFT inverted */
+    if (tft_flash_counter == 0) {
+        tft_flash_counter = TFT_FLASHING_COUNTER;
+        swtimer_start(&tft_flash_timer, TFT_FLASHING_PERIOD, TFT_FLASHING_PERIOD);
+    }
 }
 
 /**
@@ -1020,8 +1134,9 @@ static void event_handler(void)
         event_t event;
         uint8_t data = 0;
         if (!event_get(&event, &data)) {
-            hw_longpress_check();
-            ui_tick();
+            swtimer_run();
+            /** Nothing to do until the next interrupt or systick */
+            hw_idle();
         } else {
             if (event) {
                 emu_printf(" Event %d 0x%02x\n", event, data);
@@ -1030,11 +1145,20 @@ static void event_handler(void)
                 case event_none:
                     dbg_printf("Weird, should not receive 'none events'\n");
                     break;
+#ifdef CONFIG_COMMANDLINE
                 case event_uart_rx:
                     serial_handle_rx_char(data);
                     break;
+#else // CONFIG_COMMANDLINE
+                case event_frame_ready:
+                    serial_handle_frame(data);
+                    break;
+#endif // CONFIG_COMMANDLINE
                 case event_ocp:
                     break;
+                case event_measurement:
+                    hw_ack_measurement();
+                    break;
                 default:
                     break;
             }
@@ -1077,6 +1201,12 @@ int main(int argc, char const *argv[])
     }
 
     pwrctl_init(&g_past); // Must be after DAC init and Past init
+#ifdef CONFIG_HISTORY
+    history_init((uint32_t) &_history_start, ((uint32_t) &_history_end - (uint32_t) &_history_start) / 1024);
+#endif // CONFIG_HISTORY
+#ifdef CONFIG_PROFILE
+    profile_init();
+#endif // CONFIG_PROFILE
     event_init();
     check_master_reset();
     read_past_settings();
@@ -1104,7 +1234,12 @@ int main(int argc, char const *argv[])
     delay_ms(750);
     tft_clear();
     uui_refresh(current_ui, true);
+#else // CONFIG_SPLASH_SCREEN
+    /** Light up the display now that the UI has been drawn */
+    hw_enable_backlight(last_tft_brightness);
 #endif // CONFIG_SPLASH_SCREEN
+    /** Also starts the fallback timer */
+    ui_update();
 #ifdef CONFIG_WDOG
     wdog_init();
 #endif // CONFIG_WDOG
@@ -120,11 +120,12 @@ set_param_status_t opendps_set_calibration(char *name, float *value);
 bool opendps_clear_calibration(void);
 
 /**
- * @brief      Enable output of current function
+ * @brief      Enable output of current function. The output is switched
+ *             before returning, without going through the event queue.
  *
  * @param[in]  enable  Enable or disable
  *
- * @return     True if enable was successful
+ * @return     True if the output is in the requested state
  */
 bool opendps_enable_output(bool enable);
 
@@ -195,6 +196,12 @@ void opendps_upgrade_start(void);
  */
 bool opendps_change_screen(uint8_t screen_id);
 
+/**
+ * @brief      Redraw the whole UI, eg. after something else has drawn on the
+ *             screen
+ */
+void opendps_redraw(void);
+
 /**
  * @brief      Check if baud rate is in the supported set
  *
@@ -135,6 +135,7 @@ static inline uint32_t flash_read32(uint32_t address); /** @todo Make a macro ou
 static bool copy_parameters(past_t *past, uint32_t src_base, uint32_t dst_base);
 #endif // CONFIG_PAST_NO_GC
 static uint32_t past_remaining_size(past_t *past);
+static bool past_remove_duplicates(past_t *past);
 
 /**
   * @brief Initialize the past, format or garbage collect if needed
@@ -187,6 +188,9 @@ bool past_init(past_t *past)
                 }
                 check_addr += 4;
             }
+            if (success) {
+                success &= past_remove_duplicates(past);
+            }
         }
     }
     return success;
@@ -340,10 +344,9 @@ bool past_erase_unit(past_t *past, past_id_t id)
     bool success = false;
     do {
         int32_t address = past_find_unit(past, id);
-        if (address == 0) {
+        if (address <= 0) {
+            /** Unit not found */
             break;
-        } else if (address < 0) {
-            /** @todo: format past */
         }
         if (!past_erase_unit_at((uint32_t) address)) {
             break;
@@ -423,12 +426,13 @@ static bool past_erase_unit_at(uint32_t address)
         length = 4*(length/4) + 4;
     }
     do {
+        /** Wipe unit id first so a power loss never leaves a valid id in
+          * front of partially wiped data */
+        success &= flash_write32(address, 0);
         /** Wipe data, always an even multiple of 4 bytes */
         for (uint32_t i = 0; i < length/4 && success; i++) {
             success &= flash_write32(address + UNIT_DATA_OFFSET + 4*i, 0);
         }
-        /** Wipe unit id */
-        success &= flash_write32(address, 0);
     } while(0);
     lock_flash();
     return success;
@@ -475,6 +479,49 @@ static int32_t past_find_unit(past_t *past, past_id_t id)
     return found ? (int32_t) cur_address : -1;
 }
 
+/**
+  * @brief Erase all but the last copy of each unit. Power lost after a unit
+  *        was rewritten but before the old version was erased leaves two
+  *        valid copies, the later one being the newer.
+  * @param past pointer to an initialized past structure
+  * @retval true if no duplicates were found or they were erased successfully
+  */
+static bool past_remove_duplicates(past_t *past)
+{
+    bool success = true;
+    uint32_t address = past->blocks[past->_cur_block] + HEADER_FIRST_UNIT_OFFSET;
+    while (success && address < past->_end_addr) {
+        uint32_t id = flash_read32(address);
+        uint32_t size = flash_read32(address + UNIT_SIZE_OFFSET);
+        if (size == 0 || size == 0xffffffff) {
+            break;
+        }
+        if (size % 4) {
+            size += 4 - (size % 4); // Word align
+        }
+        uint32_t next = address + UNIT_DATA_OFFSET + size;
+        if (id != PAST_UNIT_ID_INVALID) {
+            uint32_t later = next;
+            while (later < past->_end_addr) {
+                if (flash_read32(later) == id) {
+                    success = past_erase_unit_at(address);
+                    break;
+                }
+                size = flash_read32(later + UNIT_SIZE_OFFSET);
+                if (size == 0 || size == 0xffffffff) {
+                    break;
+                }
+                if (size % 4) {
+                    size += 4 - (size % 4); // Word align
+                }
+                later += UNIT_DATA_OFFSET + size;
+            }
+        }
+        address = next;
+    }
+    return success;
+}
+
 /**
   * @brief Perform garbage collection
   * @param past pointer to an initialized past structure
@@ -0,0 +1,173 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#ifdef DPS_EMULATOR
+ #include <time.h>
+#else // DPS_EMULATOR
+ #include <dwt.h>
+ #include <rcc.h>
+#endif // DPS_EMULATOR
+#include "spi_driver.h"
+#include "profile.h"
+
+/*
+ * The entries are kept in the order they were first seen. On target the
+ * cycles come from the DWT cycle counter, the emulator counts nanoseconds.
+ */
+
+static profile_entry_t entries[PROFILE_MAX_ENTRIES];
+static uint32_t num_entries;
+
+/**
+  * @brief Read the cycle counter
+  * @retval the cycle count, wraps at 2^32
+  */
+static uint32_t read_cycles(void)
+{
+#ifdef DPS_EMULATOR
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) now.tv_sec * 1000000000 + now.tv_nsec;
+#else // DPS_EMULATOR
+    return dwt_read_cycle_counter();
+#endif // DPS_EMULATOR
+}
+
+/**
+  * @brief Find the entry of a measurement, adds it if this is the first one
+  * @param kind what is measured
+  * @param screen name of the screen or NULL
+  * @param item index of the item in the screen or PROFILE_NO_ITEM
+  * @retval the entry or NULL if all entries are in use
+  */
+static profile_entry_t *find_entry(profile_kind_t kind, const char *screen, uint8_t item)
+{
+    for (uint32_t i = 0; i < num_entries; i++) {
+        if (entries[i].kind == kind && entries[i].screen == screen && entries[i].item == item) {
+            return &entries[i];
+        }
+    }
+    if (num_entries == PROFILE_MAX_ENTRIES) {
+        return NULL;
+    }
+    profile_entry_t *entry = &entries[num_entries++];
+    memset(entry, 0, sizeof(*entry));
+    entry->kind = kind;
+    entry->screen = screen;
+    entry->item = item;
+    return entry;
+}
+
+/**
+  * @brief Initialize the profiler and start the cycle counter
+  * @retval none
+  */
+void profile_init(void)
+{
+#ifndef DPS_EMULATOR
+    dwt_enable_cycle_counter();
+#endif // DPS_EMULATOR
+    profile_clear();
+}
+
+/**
+  * @brief Start a measurement, use PROFILE_START(...)
+  * @param mark the measurement start
+  * @param kind what is measured
+  * @param screen name of the screen or NULL
+  * @param item index of the item in the screen or PROFILE_NO_ITEM
+  * @retval none
+  */
+void profile_start(profile_mark_t *mark, profile_kind_t kind, const char *screen, uint8_t item)
+{
+    mark->entry = find_entry(kind, screen, item);
+    mark->bytes = spi_dma_bytes_queued();
+    /** Read last so the lookup is not counted */
+    mark->cycles = read_cycles();
+}
+
+/**
+  * @brief End a measurement and add it to its entry, use PROFILE_STOP(...)
+  * @param mark the measurement start
+  * @retval none
+  */
+void profile_stop(profile_mark_t *mark)
+{
+    uint32_t cycles = read_cycles() - mark->cycles;
+    if (mark->entry) {
+        mark->entry->calls++;
+        mark->entry->cycles += cycles;
+        mark->entry->bytes += spi_dma_bytes_queued() - mark->bytes;
+    }
+}
+
+/**
+  * @brief Read entries
+  * @param index index of the first entry to read
+  * @param dest buffer receiving up to PROFILE_CHUNK_ENTRIES entries
+  * @retval number of entries read
+  */
+uint32_t profile_read(uint32_t index, profile_entry_t *dest)
+{
+    uint32_t count = 0;
+    while (count < PROFILE_CHUNK_ENTRIES && index + count < num_entries) {
+        dest[count] = entries[index + count];
+        count++;
+    }
+    return count;
+}
+
+/**
+  * @brief Get the number of entries in use
+  * @retval number of entries
+  */
+uint32_t profile_num_entries(void)
+{
+    return num_entries;
+}
+
+/**
+  * @brief Get the rate of the cycle counter
+  * @retval cycles per second
+  */
+uint32_t profile_cycles_per_second(void)
+{
+#ifdef DPS_EMULATOR
+    return 1000000000;
+#else // DPS_EMULATOR
+    return rcc_ahb_frequency;
+#endif // DPS_EMULATOR
+}
+
+/**
+  * @brief Remove all entries
+  * @retval none
+  */
+void profile_clear(void)
+{
+    num_entries = 0;
+}
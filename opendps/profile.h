@@ -0,0 +1,140 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Profile - UI draw time and display traffic counters
+ *
+ * Code that draws on the display is bracketed by PROFILE_START(...) and
+ * PROFILE_STOP(...), which add the CPU cycles spent and the bytes queued for
+ * the display to an entry keyed by what was measured, the screen and the item
+ * index. Scopes nest, so the tft_puts(...) cycles of a number item are also
+ * counted in the item's draw entry. Cycles are CPU time only, the display is
+ * fed by DMA in the background. The macros compile to nothing unless
+ * CONFIG_PROFILE is defined.
+ */
+
+/** Max number of counter entries, entries beyond this are not counted */
+#define PROFILE_MAX_ENTRIES  (24)
+
+/** Number of entries returned by one profile_read(...) call, sized to fit a
+  * fully escaped uframe */
+#define PROFILE_CHUNK_ENTRIES  (2)
+
+/** Max length of a screen name in an entry, including the terminator */
+#define PROFILE_NAME_SIZE  (12)
+
+/** Item index of entries not tied to an item */
+#define PROFILE_NO_ITEM  (0xff)
+
+/** What a profile entry measures */
+typedef enum {
+    profile_item_draw = 0, /** An item drawn by uui_refresh(...) */
+    profile_screen_tick, /** The tick callback of a screen, run by uui_tick(...) */
+    profile_putch, /** tft_putch(...), all screens */
+    profile_puts, /** tft_puts(...), all screens */
+    profile_blit, /** tft_blit(...), all screens */
+    profile_blit_rle, /** tft_blit_rle(...), all screens */
+} profile_kind_t;
+
+/** Accumulated counters of a profiled piece of code */
+typedef struct {
+    profile_kind_t kind;
+    const char *screen; /** Name of the screen, NULL for the tft functions */
+    uint8_t item; /** Index of the item in the screen or PROFILE_NO_ITEM */
+    uint32_t calls;
+    uint32_t cycles; /** Wraps, clear the counters before measuring */
+    uint32_t bytes; /** Bytes queued for the display */
+} profile_entry_t;
+
+/** Start of a measurement, on the stack of the profiled code */
+typedef struct {
+    profile_entry_t *entry;
+    uint32_t cycles;
+    uint32_t bytes;
+} profile_mark_t;
+
+#ifdef CONFIG_PROFILE
+ #define PROFILE_START(mark, kind, screen, item) profile_mark_t mark; profile_start(&mark, kind, screen, item)
+ #define PROFILE_STOP(mark) profile_stop(&mark)
+#else // CONFIG_PROFILE
+ #define PROFILE_START(mark, kind, screen, item)
+ #define PROFILE_STOP(mark)
+#endif // CONFIG_PROFILE
+
+/**
+  * @brief Initialize the profiler and start the cycle counter
+  * @retval none
+  */
+void profile_init(void);
+
+/**
+  * @brief Start a measurement, use PROFILE_START(...)
+  * @param mark the measurement start
+  * @param kind what is measured
+  * @param screen name of the screen or NULL
+  * @param item index of the item in the screen or PROFILE_NO_ITEM
+  * @retval none
+  */
+void profile_start(profile_mark_t *mark, profile_kind_t kind, const char *screen, uint8_t item);
+
+/**
+  * @brief End a measurement and add it to its entry, use PROFILE_STOP(...)
+  * @param mark the measurement start
+  * @retval none
+  */
+void profile_stop(profile_mark_t *mark);
+
+/**
+  * @brief Read entries
+  * @param index index of the first entry to read
+  * @param dest buffer receiving up to PROFILE_CHUNK_ENTRIES entries
+  * @retval number of entries read
+  */
+uint32_t profile_read(uint32_t index, profile_entry_t *dest);
+
+/**
+  * @brief Get the number of entries in use
+  * @retval number of entries
+  */
+uint32_t profile_num_entries(void);
+
+/**
+  * @brief Get the rate of the cycle counter
+  * @retval cycles per second
+  */
+uint32_t profile_cycles_per_second(void);
+
+/**
+  * @brief Remove all entries
+  * @retval none
+  */
+void profile_clear(void);
+
+#endif // __PROFILE_H__
@@ -61,6 +61,11 @@ typedef enum {
     cmd_change_screen,
     cmd_set_brightness,
     cmd_set_baud,
+    cmd_history_read,
+    cmd_profile_read,
+    cmd_diagnostics,
+    cmd_waveform_write,
+    cmd_sequence_write,
     cmd_response = 0x80
 } command_t;
 
@@ -279,6 +284,85 @@ bool protocol_unpack_upgrade_start(frame_t *frame, uint16_t *chunk_size, uint16_
  *  HOST:   [cmd_upgrade_data] [<payload>]+
  *  DPS BL: [cmd_response | cmd_upgrade_data] [<upgrade_status_t>]
  *
+ *
+ * === Downloading the measurement history ===
+ * The DPS keeps a log of V_out, I_out, V_in and output energy in flash (see
+ * history.c for the format of the log words). The log is read in chunks of up
+ * to 11 words starting at a log position. Positions older than the oldest
+ * data still in flash are moved forward, the response holds the position of
+ * the first word returned. The host continues with <offset> + <count> until
+ * it reaches <head> and may store that position to resume later. <interval>
+ * is the number of seconds between two samples and <uptime> the current
+ * uptime in seconds, allowing the host to timestamp the current session.
+ *
+ *  HOST:   [cmd_history_read] [<offset:32>]
+ *  DPS:    [cmd_response | cmd_history_read] [1] [<interval:16>] [<uptime:32>] [<head:32>] [<offset:32>] [<count:8>] [<word:32>]*
+ *
+ *
+ * === Reading the UI profile counters ===
+ * Firmware built with CONFIG_PROFILE counts the CPU cycles spent and the bytes
+ * queued for the display when drawing (see profile.h). The counters are read
+ * in chunks of up to 2 entries starting at an entry index, the host continues
+ * with <index> + <count> until it reaches <total>. If <clear> is 1 all entries
+ * are removed after the response was built, starting a new measurement.
+ * <cycles_per_second> converts cycles to time. <kind> is a profile_kind_t and
+ * <item> the index of the item in the screen, 0xff if the entry is not tied to
+ * an item. <screen> is the screen name, empty for the tft functions.
+ *
+ *  HOST:   [cmd_profile_read] [<index:8>] [<clear:8>]
+ *  DPS:    [cmd_response | cmd_profile_read] [1] [<cycles_per_second:32>] [<total:8>] [<index:8>] [<count:8>] ([<kind:8>] [<item:8>] [<calls:32>] [<cycles:32>] [<bytes:32>] [<screen:cstr>])*
+ *
+ *
+ * === Reading the diagnostics ===
+ * The main loop sleeps until the next interrupt when it has nothing to do.
+ * <idle> is the time spent sleeping during the last second in 0.1%, <max_busy>
+ * the longest time in us the loop was awake during that second, which bounds
+ * the time an event such as a received byte or a button press waits before it
+ * is handled, and <wakeups> the number of wakeups during that second.
+ * <uptime> is in seconds. <high_overflows> and <bulk_overflows> count the
+ * events dropped since start up because the fifo of their class was full, the
+ * high priority class holds protection events, buttons and measurements and
+ * the bulk class received UART bytes.
+ *
+ *  HOST:   [cmd_diagnostics]
+ *  DPS:    [cmd_response | cmd_diagnostics] [1] [<idle:16>] [<max_busy:32>] [<wakeups:32>] [<uptime:32>] [<high_overflows:32>] [<bulk_overflows:32>]
+ *
+ *
+ * === Uploading an arbitrary waveform ===
+ * Firmware built with CONFIG_FUNCGEN_ENABLE plays one cycle of an arbitrary
+ * waveform of 2 to 256 points per period of the function generator frequency
+ * when its last function is selected. The points are in mV and written in
+ * chunks of up to 27 points, <offset> being the index of the first point in
+ * the chunk. The chunks must be written in order starting at offset 0, a
+ * chunk out of order is refused. The waveform replaces the current one when
+ * the chunk reaching <num_points> is written and is stored in flash if
+ * <persist> of that chunk is 1. Waveforms of more than 128 points cannot be
+ * stored and chunks with <persist> set are then refused. A point interval of
+ * T seconds gives a frequency of 1 / (<num_points> * T).
+ *
+ *  HOST:   [cmd_waveform_write] [<num_points:16>] [<offset:16>] [<count:8>] [<persist:8>] [<point:16>]*
+ *  DPS:    [cmd_response | cmd_waveform_write] [<success>]
+ *
+ *
+ * === Uploading a sequence program ===
+ * Firmware built with CONFIG_SEQUENCE_ENABLE runs a program of up to 32 steps
+ * in its "seq" function (see sequence.h), started and stopped by enabling the
+ * output. Each step sets the voltage <mv> and the current <ma> for <duration>
+ * ms, linearly ramping from the previous setting when <ramp> is 1. A step with
+ * a <loop_count> jumps back to step <loop_to> that many times before moving on.
+ * The program is run <passes> times, 0 runs it until stopped, and the output
+ * is switched off when it ends. The steps are written in chunks of up to 4
+ * steps, <index> being the index of the first step in the chunk. The chunks
+ * must be written in order starting at index 0, a chunk out of order is
+ * refused. The program replaces the current one when the chunk reaching
+ * <num_steps> is written. It
+ * is kept in RAM and cannot be written while running. The host follows the
+ * progress with cmd_query, the "step" and "pass" parameters are 0 when the
+ * program is not running.
+ *
+ *  HOST:   [cmd_sequence_write] [<num_steps:8>] [<index:8>] [<count:8>] [<passes:16>] ([<mv:16>] [<ma:16>] [<duration:32>] [<ramp:8>] [<loop_to:8>] [<loop_count:16>])*
+ *  DPS:    [cmd_response | cmd_sequence_write] [<success>]
+ *
  */
 
 #endif // __PROTOCOL_H__
@@ -40,6 +40,21 @@
 #include "bootcom.h"
 #include "uframe.h"
 #include "opendps.h"
+#include "tick.h"
+#include "event.h"
+#include "rxframe.h"
+#ifdef CONFIG_HISTORY
+#include "history.h"
+#endif // CONFIG_HISTORY
+#ifdef CONFIG_PROFILE
+#include "profile.h"
+#endif // CONFIG_PROFILE
+#ifdef CONFIG_FUNCGEN_ENABLE
+#include "func_gen.h"
+#endif // CONFIG_FUNCGEN_ENABLE
+#ifdef CONFIG_SEQUENCE_ENABLE
+#include "sequence.h"
+#endif // CONFIG_SEQUENCE_ENABLE
 
 #ifdef DPS_EMULATOR
  extern void dps_emul_send_frame(frame_t *frame);
@@ -51,10 +66,6 @@ typedef enum {
     cmd_success_with_response,
 } command_status_t;
 
-static uint8_t frame_buffer[MAX_FRAME_LENGTH];
-static uint32_t rx_idx = 0;
-static bool receiving_frame = false;
-
 /**
   * @brief Send a frame on the uart
   * @param frame the frame to send
@@ -528,6 +539,179 @@ static command_status_t handle_change_screen(frame_t *frame)
     }
 }
 
+/**
+  * @brief Handle a diagnostics command
+  * @retval command_status_t failed, success or "I sent my own frame"
+  */
+static command_status_t handle_diagnostics(void)
+{
+    emu_printf("%s\n", __FUNCTION__);
+    uint16_t idle;
+    uint32_t max_busy, wakeups;
+    hw_get_load(&idle, &max_busy, &wakeups);
+
+    frame_t frame_resp;
+    set_frame_header(&frame_resp);
+    pack8(&frame_resp, cmd_response | cmd_diagnostics);
+    pack8(&frame_resp, 1);
+    pack16(&frame_resp, idle);
+    pack32(&frame_resp, max_busy);
+    pack32(&frame_resp, wakeups);
+    pack32(&frame_resp, (uint32_t) (get_ticks() / 1000));
+    pack32(&frame_resp, event_overflows(event_class_high));
+    pack32(&frame_resp, event_overflows(event_class_bulk));
+    end_frame(&frame_resp);
+    send_frame(&frame_resp);
+    return cmd_success_with_response;
+}
+
+#ifdef CONFIG_HISTORY
+/**
+  * @brief Handle a history read command
+  * @param frame the received frame
+  * @retval command_status_t failed, success or "I sent my own frame"
+  */
+static command_status_t handle_history_read(frame_t *frame)
+{
+    emu_printf("%s\n", __FUNCTION__);
+    uint8_t cmd;
+    uint32_t offset, count;
+    uint32_t words[HISTORY_CHUNK_WORDS];
+    start_frame_unpacking(frame);
+    unpack8(frame, &cmd);
+    (void) cmd;
+    if (unpack32(frame, &offset) != 4) {
+        return cmd_failed;
+    }
+    offset = history_read(offset, words, &count);
+
+    frame_t frame_resp;
+    set_frame_header(&frame_resp);
+    pack8(&frame_resp, cmd_response | cmd_history_read);
+    pack8(&frame_resp, 1);
+    pack16(&frame_resp, history_interval());
+    pack32(&frame_resp, (uint32_t) (get_ticks() / 1000));
+    pack32(&frame_resp, history_head());
+    pack32(&frame_resp, offset);
+    pack8(&frame_resp, count);
+    for (uint32_t i = 0; i < count; i++) {
+        pack32(&frame_resp, words[i]);
+    }
+    end_frame(&frame_resp);
+    send_frame(&frame_resp);
+    return cmd_success_with_response;
+}
+#endif // CONFIG_HISTORY
+
+#ifdef CONFIG_PROFILE
+/**
+  * @brief Handle a profile read command
+  * @param frame the received frame
+  * @retval command_status_t failed, success or "I sent my own frame"
+  */
+static command_status_t handle_profile_read(frame_t *frame)
+{
+    emu_printf("%s\n", __FUNCTION__);
+    uint8_t cmd, index, clear;
+    profile_entry_t entries[PROFILE_CHUNK_ENTRIES];
+    start_frame_unpacking(frame);
+    unpack8(frame, &cmd);
+    (void) cmd;
+    if (unpack8(frame, &index) != 1 || unpack8(frame, &clear) != 1) {
+        return cmd_failed;
+    }
+    uint32_t count = profile_read(index, entries);
+
+    frame_t frame_resp;
+    set_frame_header(&frame_resp);
+    pack8(&frame_resp, cmd_response | cmd_profile_read);
+    pack8(&frame_resp, 1);
+    pack32(&frame_resp, profile_cycles_per_second());
+    pack8(&frame_resp, profile_num_entries());
+    pack8(&frame_resp, index);
+    pack8(&frame_resp, count);
+    for (uint32_t i = 0; i < count; i++) {
+        char screen[PROFILE_NAME_SIZE] = {0};
+        if (entries[i].screen) {
+            strncpy(screen, entries[i].screen, sizeof(screen) - 1);
+        }
+        pack8(&frame_resp, entries[i].kind);
+        pack8(&frame_resp, entries[i].item);
+        pack32(&frame_resp, entries[i].calls);
+        pack32(&frame_resp, entries[i].cycles);
+        pack32(&frame_resp, entries[i].bytes);
+        pack_cstr(&frame_resp, screen);
+    }
+    end_frame(&frame_resp);
+    send_frame(&frame_resp);
+    if (clear) {
+        profile_clear();
+    }
+    return cmd_success_with_response;
+}
+#endif // CONFIG_PROFILE
+
+#ifdef CONFIG_FUNCGEN_ENABLE
+/**
+  * @brief Handle a chunk of an arbitrary waveform for the function generator
+  * @param frame the received frame
+  * @retval command_status_t failed, success or "I sent my own frame"
+  */
+static command_status_t handle_waveform_write(frame_t *frame)
+{
+    emu_printf("%s\n", __FUNCTION__);
+    uint8_t cmd, count, persist;
+    uint16_t num_points, offset;
+    uint16_t points[FUNC_GEN_CHUNK_POINTS];
+    start_frame_unpacking(frame);
+    unpack8(frame, &cmd);
+    (void) cmd;
+    if (unpack16(frame, &num_points) != 2 || unpack16(frame, &offset) != 2 ||
+        unpack8(frame, &count) != 1 || unpack8(frame, &persist) != 1 ||
+        count > FUNC_GEN_CHUNK_POINTS) {
+        return cmd_failed;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (unpack16(frame, &points[i]) != 2) {
+            return cmd_failed;
+        }
+    }
+    return func_gen_write_waveform(num_points, offset, points, count, persist) ? cmd_success : cmd_failed;
+}
+#endif // CONFIG_FUNCGEN_ENABLE
+
+#ifdef CONFIG_SEQUENCE_ENABLE
+/**
+  * @brief Handle a chunk of a sequence program
+  * @param frame the received frame
+  * @retval command_status_t failed, success or "I sent my own frame"
+  */
+static command_status_t handle_sequence_write(frame_t *frame)
+{
+    emu_printf("%s\n", __FUNCTION__);
+    uint8_t cmd, num_steps, index, count, ramp;
+    uint16_t passes;
+    sequence_step_t steps[SEQUENCE_CHUNK_STEPS];
+    start_frame_unpacking(frame);
+    unpack8(frame, &cmd);
+    (void) cmd;
+    if (unpack8(frame, &num_steps) != 1 || unpack8(frame, &index) != 1 ||
+        unpack8(frame, &count) != 1 || unpack16(frame, &passes) != 2 ||
+        count > SEQUENCE_CHUNK_STEPS) {
+        return cmd_failed;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (unpack16(frame, &steps[i].mv) != 2 || unpack16(frame, &steps[i].ma) != 2 ||
+            unpack32(frame, &steps[i].duration) != 4 || unpack8(frame, &ramp) != 1 ||
+            unpack8(frame, &steps[i].loop_to) != 1 || unpack16(frame, &steps[i].loop_count) != 2) {
+            return cmd_failed;
+        }
+        steps[i].ramp = ramp;
+    }
+    return sequence_write(num_steps, index, steps, count, passes) ? cmd_success : cmd_failed;
+}
+#endif // CONFIG_SEQUENCE_ENABLE
+
 /**
   * @brief Handle a receved frame
   * @param frame the received frame
@@ -606,6 +790,29 @@ static void handle_frame(uint8_t *data, uint32_t length)
             case cmd_set_baud:
                 success = handle_set_baud(&frame);
                 break;
+            case cmd_diagnostics:
+                success = handle_diagnostics();
+                break;
+#ifdef CONFIG_HISTORY
+            case cmd_history_read:
+                success = handle_history_read(&frame);
+                break;
+#endif // CONFIG_HISTORY
+#ifdef CONFIG_PROFILE
+            case cmd_profile_read:
+                success = handle_profile_read(&frame);
+                break;
+#endif // CONFIG_PROFILE
+#ifdef CONFIG_FUNCGEN_ENABLE
+            case cmd_waveform_write:
+                success = handle_waveform_write(&frame);
+                break;
+#endif // CONFIG_FUNCGEN_ENABLE
+#ifdef CONFIG_SEQUENCE_ENABLE
+            case cmd_sequence_write:
+                success = handle_sequence_write(&frame);
+                break;
+#endif // CONFIG_SEQUENCE_ENABLE
             default:
                 emu_printf("Got unknown command %d (0x%02x)\n", cmd, cmd);
                 break;
@@ -621,26 +828,16 @@ static void handle_frame(uint8_t *data, uint32_t length)
 }
 
 /**
-  * @brief Handle received character
-  * @param c well, the received character
+  * @brief Handle a frame assembled by the UART ISR and release its buffer
+  * @param index rxframe buffer index from the event_frame_ready event
   * @retval None
   */
-void serial_handle_rx_char(char c)
+void serial_handle_frame(uint8_t index)
 {
-    uint8_t b = (uint8_t) c;
-    if (b == _SOF) {
-        receiving_frame = true;
-        rx_idx = 0;
-    }
-    if (receiving_frame) {
-        if (rx_idx < sizeof(frame_buffer)) {
-            frame_buffer[rx_idx++] = b;
-            if (b == _EOF) {
-                handle_frame(frame_buffer, rx_idx);
-                receiving_frame = false;
-            }
-        } else {
-            dbg_printf("Error: RX buffer overflow!\n");
-        }
+    uint32_t length;
+    uint8_t *frame = rxframe_get(index, &length);
+    if (frame) {
+        handle_frame(frame, length);
+        rxframe_release(index);
     }
 }
@@ -27,6 +27,9 @@
 #include "pastunits.h"
 #include <gpio.h>
 #include <dac.h>
+#ifdef CONFIG_FUNCGEN_ENABLE
+#include "hw.h"
+#endif // CONFIG_FUNCGEN_ENABLE
 
 /** This module handles voltage and current calculations
   * Calculations based on measurements found at
@@ -212,6 +215,10 @@ void pwrctl_enable_vout(bool enable)
         gpio_clear(GPIOB, GPIO11);  // B11 is power control on '5005
 #endif
     } else {
+#ifdef CONFIG_FUNCGEN_ENABLE
+        /** The function generator must not keep driving the DAC, eg. after OCP */
+        hw_dds_stop();
+#endif // CONFIG_FUNCGEN_ENABLE
 #if defined(DPS5015) || defined(DPS5020)
         //gpio_set(GPIOA, GPIO9);    // gpio_set(GPIOB, GPIO11);
         gpio_clear(GPIOB, GPIO11); // B11 is fan control on '5015
@@ -22,24 +22,36 @@
  * THE SOFTWARE.
  */
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
 #include "ringbuf.h"
 
+/*
+ * The indices run freely and are masked when the buffer is accessed, so the
+ * buffer is full when they are a buffer size apart and all of it is used. The
+ * release store of an index publishes the words written before it, the
+ * acquire load of the other side's index makes sure they are seen.
+ */
+
 /**
   * @brief Initialize the ring buffer
   * @param ring pointer to ring buffer
   * @param buf buffer to store ring buffer data in
-  * @param size size of buffer
+  * @param size size of buffer in bytes, the largest power of two number of
+  *        words that fits is used
   * @retval none
   */
 void ringbuf_init(ringbuf_t *ring, uint8_t *buf, uint32_t size)
 {
+	uint32_t words = 1;
+	while (2 * words <= size / 2) {
+		words *= 2;
+	}
 	ring->buf = (uint16_t*) buf;
-	ring->size = size/2;
-	ring->read = 0;
-	ring->write = 0;
-#ifdef DPS_EMULATOR
-	pthread_mutex_init(&ring->mutex, NULL);
-#endif // DPS_EMULATOR
+	ring->mask = words - 1;
+	atomic_init(&ring->write, 0);
+	atomic_init(&ring->read, 0);
 }
 
 /**
@@ -50,19 +62,7 @@ void ringbuf_init(ringbuf_t *ring, uint8_t *buf, uint32_t size)
   */
 bool ringbuf_put(ringbuf_t *ring, uint16_t word)
 {
-    bool success = false;
-#ifdef DPS_EMULATOR
-	pthread_mutex_lock(&ring->mutex);
-#endif // DPS_EMULATOR
-	if (((ring->write + 1) % ring->size) != ring->read) {
-		ring->buf[ring->write++] = word;
-		ring->write %= ring->size;
-		success = true;
-	}
-#ifdef DPS_EMULATOR
-	pthread_mutex_unlock(&ring->mutex);
-#endif // DPS_EMULATOR
-	return success;
+	return ringbuf_put_bulk(ring, &word, 1) == 1;
 }
 
 /**
@@ -73,17 +73,62 @@ bool ringbuf_put(ringbuf_t *ring, uint16_t word)
   */
 bool ringbuf_get(ringbuf_t *ring, uint16_t *word)
 {
-    bool success = false;
-#ifdef DPS_EMULATOR
-	pthread_mutex_lock(&ring->mutex);
-#endif // DPS_EMULATOR
-	if (ring->read != ring->write) {
-		*word = ring->buf[ring->read++];
-		ring->read %= ring->size;
-		success = true;
+	return ringbuf_get_bulk(ring, word, 1) == 1;
+}
+
+/**
+  * @brief Put as many words as there is room for into the ring buffer
+  * @param ring pointer to ring buffer
+  * @param words the data to put into the buffer
+  * @param count number of words
+  * @retval number of words put
+  */
+uint32_t ringbuf_put_bulk(ringbuf_t *ring, const uint16_t *words, uint32_t count)
+{
+	uint32_t write = atomic_load_explicit(&ring->write, memory_order_relaxed);
+	/** The consumer is done with the words before the read index */
+	uint32_t read = atomic_load_explicit(&ring->read, memory_order_acquire);
+	uint32_t room = ring->mask + 1 - (write - read);
+	if (count > room) {
+		count = room;
 	}
-#ifdef DPS_EMULATOR
-	pthread_mutex_unlock(&ring->mutex);
-#endif // DPS_EMULATOR
-	return success;
+	for (uint32_t i = 0; i < count; i++) {
+		ring->buf[(write + i) & ring->mask] = words[i];
+	}
+	atomic_store_explicit(&ring->write, write + count, memory_order_release);
+	return count;
+}
+
+/**
+  * @brief Get up to a number of words from the ring buffer
+  * @param ring pointer to ring buffer
+  * @param words buffer receiving the data
+  * @param count max number of words
+  * @retval number of words pulled
+  */
+uint32_t ringbuf_get_bulk(ringbuf_t *ring, uint16_t *words, uint32_t count)
+{
+	uint32_t read = atomic_load_explicit(&ring->read, memory_order_relaxed);
+	/** The producer has written the words before the write index */
+	uint32_t write = atomic_load_explicit(&ring->write, memory_order_acquire);
+	uint32_t used = write - read;
+	if (count > used) {
+		count = used;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		words[i] = ring->buf[(read + i) & ring->mask];
+	}
+	atomic_store_explicit(&ring->read, read + count, memory_order_release);
+	return count;
+}
+
+/**
+  * @brief Check if the ring buffer is empty
+  * @param ring pointer to ring buffer
+  * @retval true if there is no data in the buffer
+  */
+bool ringbuf_empty(ringbuf_t *ring)
+{
+	return atomic_load_explicit(&ring->read, memory_order_relaxed) ==
+	       atomic_load_explicit(&ring->write, memory_order_relaxed);
 }
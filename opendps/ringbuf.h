@@ -27,26 +27,29 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 
-#ifdef DPS_EMULATOR
- #include <pthread.h>
-#endif // DPS_EMULATOR
+/*
+ * A single producer, single consumer ring buffer of 16 bit words. The
+ * producer only writes the write index and the consumer only writes the read
+ * index, so a put from an ISR and a get from the main loop (or two threads in
+ * the emulator) need no locking. Producers that may preempt each other must
+ * serialize their puts.
+ */
 
 typedef struct {
 	uint16_t *buf;
-	uint32_t size;
-	uint32_t read;
-	uint32_t write;
-#ifdef DPS_EMULATOR
- pthread_mutex_t mutex;
-#endif // DPS_EMULATOR
+	uint32_t mask; /** Number of words - 1, the number of words is a power of two */
+	_Atomic uint32_t write; /** Free running, written by the producer only */
+	_Atomic uint32_t read; /** Free running, written by the consumer only */
 } ringbuf_t;
 
 /**
   * @brief Initialize the ring buffer
   * @param ring pointer to ring buffer
   * @param buf buffer to store ring buffer data in
-  * @param size size of buffer
+  * @param size size of buffer in bytes, the largest power of two number of
+  *        words that fits is used
   * @retval none
   */
 void ringbuf_init(ringbuf_t *ring, uint8_t *buf, uint32_t size);
@@ -67,4 +70,29 @@ bool ringbuf_put(ringbuf_t *ring, uint16_t word);
   */
 bool ringbuf_get(ringbuf_t *ring, uint16_t *word);
 
+/**
+  * @brief Put as many words as there is room for into the ring buffer
+  * @param ring pointer to ring buffer
+  * @param words the data to put into the buffer
+  * @param count number of words
+  * @retval number of words put
+  */
+uint32_t ringbuf_put_bulk(ringbuf_t *ring, const uint16_t *words, uint32_t count);
+
+/**
+  * @brief Get up to a number of words from the ring buffer
+  * @param ring pointer to ring buffer
+  * @param words buffer receiving the data
+  * @param count max number of words
+  * @retval number of words pulled
+  */
+uint32_t ringbuf_get_bulk(ringbuf_t *ring, uint16_t *words, uint32_t count);
+
+/**
+  * @brief Check if the ring buffer is empty
+  * @param ring pointer to ring buffer
+  * @retval true if there is no data in the buffer
+  */
+bool ringbuf_empty(ringbuf_t *ring);
+
 #endif // __RINGBUF_H__
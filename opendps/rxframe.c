@@ -0,0 +1,114 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "uframe.h"
+#include "event.h"
+#include "rxframe.h"
+
+typedef enum {
+    rxframe_free = 0,
+    rxframe_filling, /** Owned by the ISR */
+    rxframe_ready, /** Owned by the main loop */
+} rxframe_state_t;
+
+static uint8_t buffers[RXFRAME_NUM_BUFFERS][MAX_FRAME_LENGTH];
+static uint32_t lengths[RXFRAME_NUM_BUFFERS];
+static volatile rxframe_state_t states[RXFRAME_NUM_BUFFERS];
+
+/** The buffer being filled by the ISR, -1 when not inside a frame */
+static int32_t cur_buffer = -1;
+
+/**
+  * @brief Handle a received byte, call from the UART ISR
+  * @param b the received byte
+  * @retval none
+  */
+void rxframe_put_char(uint8_t b)
+{
+    if (b == _SOF) {
+        /** A new frame start abandons an unfinished frame, reuse its buffer */
+        if (cur_buffer < 0) {
+            for (uint32_t i = 0; i < RXFRAME_NUM_BUFFERS; i++) {
+                if (states[i] == rxframe_free) {
+                    states[i] = rxframe_filling;
+                    cur_buffer = i;
+                    break;
+                }
+            }
+        }
+        if (cur_buffer < 0) {
+            /** All buffers in use, drop the frame */
+            return;
+        }
+        lengths[cur_buffer] = 0;
+    }
+    if (cur_buffer < 0) {
+        return;
+    }
+
+    if (lengths[cur_buffer] == MAX_FRAME_LENGTH) {
+        /** Too long to be a frame, drop it */
+        states[cur_buffer] = rxframe_free;
+        cur_buffer = -1;
+        return;
+    }
+    buffers[cur_buffer][lengths[cur_buffer]++] = b;
+    if (b == _EOF) {
+        states[cur_buffer] = rxframe_ready;
+        if (!event_put(event_frame_ready, (uint8_t) cur_buffer)) {
+            states[cur_buffer] = rxframe_free;
+        }
+        cur_buffer = -1;
+    }
+}
+
+/**
+  * @brief Get a frame posted with event_frame_ready
+  * @param index buffer index from the event data
+  * @param length (out) number of bytes in the frame, _SOF and _EOF included
+  * @retval the frame or NULL if the index is not a received frame
+  */
+uint8_t *rxframe_get(uint8_t index, uint32_t *length)
+{
+    if (index >= RXFRAME_NUM_BUFFERS || states[index] != rxframe_ready) {
+        return NULL;
+    }
+    *length = lengths[index];
+    return buffers[index];
+}
+
+/**
+  * @brief Return a frame buffer to the pool
+  * @param index buffer index from the event data
+  * @retval none
+  */
+void rxframe_release(uint8_t index)
+{
+    if (index < RXFRAME_NUM_BUFFERS) {
+        states[index] = rxframe_free;
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __RXFRAME_H__
+#define __RXFRAME_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Receive frame pool - the UART ISR collects the bytes of a frame, from _SOF
+ * to _EOF, into one of a few frame buffers and posts a single
+ * event_frame_ready carrying the buffer index when the frame is complete.
+ * The main loop handles the frame and releases the buffer. Frames arriving
+ * while all buffers are in use are dropped, as are frames too long for a
+ * buffer.
+ */
+
+/** Two buffers let the next frame arrive while one is being handled */
+#define RXFRAME_NUM_BUFFERS  (2)
+
+/**
+  * @brief Handle a received byte, call from the UART ISR
+  * @param b the received byte
+  * @retval none
+  */
+void rxframe_put_char(uint8_t b);
+
+/**
+  * @brief Get a frame posted with event_frame_ready
+  * @param index buffer index from the event data
+  * @param length (out) number of bytes in the frame, _SOF and _EOF included
+  * @retval the frame or NULL if the index is not a received frame
+  */
+uint8_t *rxframe_get(uint8_t index, uint32_t *length);
+
+/**
+  * @brief Return a frame buffer to the pool
+  * @param index buffer index from the event data
+  * @retval none
+  */
+void rxframe_release(uint8_t index);
+
+#endif // __RXFRAME_H__
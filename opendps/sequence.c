@@ -0,0 +1,217 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "sequence.h"
+
+static sequence_step_t program[SEQUENCE_MAX_STEPS];
+static uint32_t num_steps;
+static uint32_t passes;
+/** The program being written and the index of the chunk expected next, 0
+    when no program is being written */
+static uint32_t write_num_steps;
+static uint32_t write_index;
+
+static bool is_running;
+static uint32_t cur_step;
+static uint32_t cur_pass;
+/** Jumps taken by the steps with a loop count */
+static uint16_t loop_counters[SEQUENCE_MAX_STEPS];
+/** Time the current step started, the end of the step before it */
+static uint64_t step_start;
+/** Settings at the end of the previous step, where a ramp starts */
+static uint32_t from_mv, from_ma;
+
+/**
+  * @brief Write a chunk of the program. The chunks must be written in order
+  *        starting at index 0 and the program replaces the current one when
+  *        the chunk reaching its end is written, it cannot be written while
+  *        running
+  * @param num_steps number of steps in the program, 1 to SEQUENCE_MAX_STEPS
+  * @param index index of the first step in the chunk
+  * @param steps the steps
+  * @param count number of steps in the chunk
+  * @param passes number of times the program is run, 0 to run until stopped
+  * @retval false if the program is running, the chunk is out of order, a step
+  *         is invalid or passes is above SEQUENCE_MAX_PASSES
+  */
+bool sequence_write(uint32_t _num_steps, uint32_t index, const sequence_step_t *steps, uint32_t count, uint32_t _passes)
+{
+    if (is_running || _num_steps == 0 || _num_steps > SEQUENCE_MAX_STEPS || index + count > _num_steps ||
+        _passes > SEQUENCE_MAX_PASSES) {
+        return false;
+    }
+    if (index != 0 && (index != write_index || _num_steps != write_num_steps)) {
+        /** A lost or repeated chunk would leave stale steps in the program */
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (steps[i].duration == 0 || steps[i].loop_to > index + i) {
+            return false;
+        }
+    }
+    if (index == 0) {
+        /** A half written program must not be started */
+        num_steps = 0;
+        write_num_steps = _num_steps;
+    }
+    memcpy(&program[index], steps, count * sizeof(sequence_step_t));
+    write_index = index + count;
+    if (write_index == _num_steps) {
+        num_steps = _num_steps;
+        passes = _passes;
+        write_index = 0;
+    }
+    return true;
+}
+
+/**
+  * @brief Get the number of steps in the program
+  * @retval number of steps, 0 if no program has been written
+  */
+uint32_t sequence_num_steps(void)
+{
+    return num_steps;
+}
+
+/**
+  * @brief Set the number of times the program is run
+  * @param passes number of passes, 0 to run until stopped
+  * @retval none
+  */
+void sequence_set_passes(uint32_t _passes)
+{
+    passes = _passes;
+}
+
+/**
+  * @brief Get the number of times the program is run
+  * @retval number of passes, 0 to run until stopped
+  */
+uint32_t sequence_passes(void)
+{
+    return passes;
+}
+
+/**
+  * @brief Start the program from its first step, a first step ramp starts
+  *        at 0V and 0A
+  * @param now current time in ms
+  * @retval false if there is no program
+  */
+bool sequence_start(uint64_t now)
+{
+    if (!num_steps) {
+        return false;
+    }
+    memset(loop_counters, 0, sizeof(loop_counters));
+    cur_step = 0;
+    cur_pass = 0;
+    step_start = now;
+    from_mv = 0;
+    from_ma = 0;
+    is_running = true;
+    return true;
+}
+
+/**
+  * @brief Stop the program
+  * @retval none
+  */
+void sequence_stop(void)
+{
+    is_running = false;
+}
+
+/**
+  * @brief Move on from the current step, following its loop
+  * @retval false if that was the last step of the last pass
+  */
+static bool next_step(void)
+{
+    sequence_step_t *step = &program[cur_step];
+    if (loop_counters[cur_step] < step->loop_count) {
+        loop_counters[cur_step]++;
+        cur_step = step->loop_to;
+        return true;
+    }
+    /** Done, an enclosing loop runs this loop again from the start */
+    loop_counters[cur_step] = 0;
+    if (++cur_step < num_steps) {
+        return true;
+    }
+    cur_step = 0;
+    return ++cur_pass != passes;
+}
+
+/**
+  * @brief Move the program to the current time and get the settings
+  * @param now current time in ms
+  * @param mv (out) voltage setting
+  * @param ma (out) current setting
+  * @retval time in ms of the next update or SEQUENCE_END if the program has
+  *         ended, the settings are not updated then
+  */
+uint64_t sequence_update(uint64_t now, uint32_t *mv, uint32_t *ma)
+{
+    if (!is_running) {
+        return SEQUENCE_END;
+    }
+    while (now >= step_start + program[cur_step].duration) {
+        step_start += program[cur_step].duration;
+        from_mv = program[cur_step].mv;
+        from_ma = program[cur_step].ma;
+        if (!next_step()) {
+            is_running = false;
+            return SEQUENCE_END;
+        }
+    }
+    sequence_step_t *step = &program[cur_step];
+    uint64_t step_end = step_start + step->duration;
+    if (!step->ramp) {
+        *mv = step->mv;
+        *ma = step->ma;
+        return step_end;
+    }
+    uint32_t elapsed = now - step_start;
+    *mv = from_mv + ((int64_t) step->mv - from_mv) * elapsed / step->duration;
+    *ma = from_ma + ((int64_t) step->ma - from_ma) * elapsed / step->duration;
+    return now + SEQUENCE_RAMP_INTERVAL < step_end ? now + SEQUENCE_RAMP_INTERVAL : step_end;
+}
+
+/**
+  * @brief Get the progress of the program
+  * @param step (out) current step, counted from 1
+  * @param pass (out) current pass, counted from 1
+  * @retval true if the program is running
+  */
+bool sequence_progress(uint32_t *step, uint32_t *pass)
+{
+    *step = is_running ? cur_step + 1 : 0;
+    *pass = is_running ? cur_pass + 1 : 0;
+    return is_running;
+}
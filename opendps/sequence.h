@@ -0,0 +1,130 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef __SEQUENCE_H__
+#define __SEQUENCE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Sequence programs - a list of steps, each holding a voltage and current
+ * setting for a duration, run on the device. A step may ramp linearly from
+ * the setting of the step before it and may jump back to an earlier step a
+ * number of times, allowing nested loops. The whole program is repeated a
+ * number of passes. Step times are counted from the start of the program, a
+ * late update catches up without moving the following steps.
+ *
+ * This module only does the book keeping, the caller feeds it the current
+ * time and applies the settings it returns (see func_seq.c).
+ */
+
+/** Most steps in a program */
+#define SEQUENCE_MAX_STEPS  (32)
+/** Most steps in one upload chunk, fills a frame (see protocol.h) */
+#define SEQUENCE_CHUNK_STEPS  (4)
+/** Most passes of a program, 0 runs it until stopped */
+#define SEQUENCE_MAX_PASSES  (9999)
+/** Time between two setting updates during a ramp (ms) */
+#define SEQUENCE_RAMP_INTERVAL  (10)
+/** Returned by sequence_update() when the program is not running */
+#define SEQUENCE_END  (UINT64_MAX)
+
+typedef struct {
+    uint32_t duration; /** Time in ms, at least 1 */
+    uint16_t mv; /** Voltage setting */
+    uint16_t ma; /** Current setting */
+    uint16_t loop_count; /** Jumps to loop_to before moving on, 0 for none */
+    uint8_t loop_to; /** Step to jump to, this step or an earlier one */
+    bool ramp; /** Ramp from the previous setting over the duration */
+} sequence_step_t;
+
+/**
+  * @brief Write a chunk of the program. The chunks must be written in order
+  *        starting at index 0 and the program replaces the current one when
+  *        the chunk reaching its end is written, it cannot be written while
+  *        running
+  * @param num_steps number of steps in the program, 1 to SEQUENCE_MAX_STEPS
+  * @param index index of the first step in the chunk
+  * @param steps the steps
+  * @param count number of steps in the chunk
+  * @param passes number of times the program is run, 0 to run until stopped
+  * @retval false if the program is running, the chunk is out of order, a step
+  *         is invalid or passes is above SEQUENCE_MAX_PASSES
+  */
+bool sequence_write(uint32_t num_steps, uint32_t index, const sequence_step_t *steps, uint32_t count, uint32_t passes);
+
+/**
+  * @brief Get the number of steps in the program
+  * @retval number of steps, 0 if no program has been written
+  */
+uint32_t sequence_num_steps(void);
+
+/**
+  * @brief Set the number of times the program is run
+  * @param passes number of passes, 0 to run until stopped
+  * @retval none
+  */
+void sequence_set_passes(uint32_t passes);
+
+/**
+  * @brief Get the number of times the program is run
+  * @retval number of passes, 0 to run until stopped
+  */
+uint32_t sequence_passes(void);
+
+/**
+  * @brief Start the program from its first step, a first step ramp starts
+  *        at 0V and 0A
+  * @param now current time in ms
+  * @retval false if there is no program
+  */
+bool sequence_start(uint64_t now);
+
+/**
+  * @brief Stop the program
+  * @retval none
+  */
+void sequence_stop(void);
+
+/**
+  * @brief Move the program to the current time and get the settings
+  * @param now current time in ms
+  * @param mv (out) voltage setting
+  * @param ma (out) current setting
+  * @retval time in ms of the next update or SEQUENCE_END if the program has
+  *         ended, the settings are not updated then
+  */
+uint64_t sequence_update(uint64_t now, uint32_t *mv, uint32_t *ma);
+
+/**
+  * @brief Get the progress of the program
+  * @param step (out) current step, counted from 1
+  * @param pass (out) current pass, counted from 1
+  * @retval true if the program is running
+  */
+bool sequence_progress(uint32_t *step, uint32_t *pass);
+
+#endif // __SEQUENCE_H__
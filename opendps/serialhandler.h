@@ -25,6 +25,22 @@
 #ifndef __SERIALHANDER_H__
 #define __SERIALHANDER_H__
 
+#include <stdint.h>
+
+#ifdef CONFIG_COMMANDLINE
+/**
+  * @brief Handle a character received on the command line
+  * @param c the received character
+  * @retval None
+  */
 void serial_handle_rx_char(char c);
+#else // CONFIG_COMMANDLINE
+/**
+  * @brief Handle a frame assembled by the UART ISR and release its buffer
+  * @param index rxframe buffer index from the event_frame_ready event
+  * @retval None
+  */
+void serial_handle_frame(uint8_t index);
+#endif // CONFIG_COMMANDLINE
 
 #endif // __SERIALHANDER_H__
\ No newline at end of file
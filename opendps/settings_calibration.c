@@ -176,7 +176,7 @@ ui_number_t calibration_a_adc = {
 ui_screen_t calibration_screen = {
     .id = SCREEN_ID,
     .name = "calibration",
-    .icon_data = (uint8_t *) gfx_crosshair,
+    .icon_data = gfx_crosshair,
     .icon_data_len = sizeof(gfx_crosshair),
     .icon_width = GFX_CROSSHAIR_WIDTH,
     .icon_height = GFX_CROSSHAIR_HEIGHT,
@@ -352,20 +352,9 @@ static void calibration_tick(void)
     uint16_t i_out_raw, v_in_raw, v_out_raw;
     hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
 
-    if (v_in_raw != calibration_vin_adc.value) {
-        calibration_vin_adc.value = v_in_raw;
-        calibration_vin_adc.ui.draw(&calibration_vin_adc.ui);
-    }
-
-    if (v_out_raw != calibration_v_adc.value) {
-        calibration_v_adc.value = v_out_raw;
-        calibration_v_adc.ui.draw(&calibration_v_adc.ui);
-    }
-
-    if (i_out_raw != calibration_a_adc.value) {
-        calibration_a_adc.value = i_out_raw;
-        calibration_a_adc.ui.draw(&calibration_a_adc.ui);
-    }
+    (void) number_update(&calibration_vin_adc, v_in_raw);
+    (void) number_update(&calibration_v_adc, v_out_raw);
+    (void) number_update(&calibration_a_adc, i_out_raw);
 }
 
 /**
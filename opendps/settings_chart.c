@@ -0,0 +1,186 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hw.h"
+#include "pwrctl.h"
+#include "swtimer.h"
+#include "settings_chart.h"
+#include "uui.h"
+#include "uui_chart.h"
+#include "dps-model.h"
+#include "ili9163c.h"
+
+/*
+ * This is the implementation of the strip chart screen. It plots V_out and
+ * I_out over time, one column every CONFIG_CHART_INTERVAL ms. The display
+ * controller scrolls the whole display so the chart takes up the entire
+ * screen and the status bar is hidden while it is shown.
+ */
+
+static void chart_tick(void);
+static void activated(void);
+static void deactivated(void);
+static void sample_fired(swtimer_t *timer);
+
+/* Adds a column every CONFIG_CHART_INTERVAL ms while the chart is shown,
+   the screen tick only runs when new measurements arrive */
+static swtimer_t sample_timer = {
+    .callback = &sample_fired,
+};
+
+#define SCREEN_ID  (4)
+
+#ifndef CONFIG_CHART_INTERVAL
+ #define CONFIG_CHART_INTERVAL  (500)
+#endif // CONFIG_CHART_INTERVAL
+
+/** Measurements summed since the last sample */
+static uint32_t v_out_sum;
+static uint32_t i_out_sum;
+static uint32_t num_summed;
+
+/* This is the definition of the chart item in the UI */
+ui_chart_t chart_plot = {
+    {
+        .type = ui_item_chart,
+        .id = 10,
+        .x = 0,
+        .y = 0,
+        .can_focus = false,
+    },
+    .height = 128,
+    .grid_spacing = 16,
+    .bg_color = BLACK,
+    .grid_color = DARKGREY,
+    .colors = { YELLOW, CYAN }, /** V_out, I_out */
+    .full_scale = { 0, CONFIG_DPS_MAX_CURRENT }, /** V_out scale is set on activation */
+};
+
+/* This is the screen definition */
+ui_screen_t chart_screen = {
+    .id = SCREEN_ID,
+    .name = "chart",
+    .icon_data = NULL, /** The icon would scroll with the chart */
+    .is_fullscreen = true,
+    .activated = &activated,
+    .deactivated = &deactivated,
+    .enable = NULL,
+    .past_save = NULL,
+    .past_restore = NULL,
+    .tick = &chart_tick,
+    .set_parameter = NULL,
+    .get_parameter = NULL,
+    .num_items = 1,
+    .parameters = {
+        {
+            .name = {'\0'} /** Terminator */
+        },
+    },
+    .items = { (ui_item_t*) &chart_plot }
+};
+
+/**
+ * @brief      Scale the voltage trace to the input voltage, which the output
+ *             can not exceed. The chart is restarted if the scale changed.
+ */
+static void activated(void)
+{
+    uint16_t i_out_raw, v_in_raw, v_out_raw;
+    hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
+    (void) i_out_raw;
+    (void) v_out_raw;
+
+    /** Round up to whole volts */
+    uint32_t full_scale = (pwrctl_calc_vin(v_in_raw) + 999) / 1000 * 1000;
+    if (full_scale == 0) {
+        full_scale = 1000;
+    }
+    if (chart_plot.full_scale[0] != full_scale) {
+        chart_plot.full_scale[0] = full_scale;
+        chart_clear(&chart_plot);
+        chart_plot.ui.draw(&chart_plot.ui);
+    }
+    num_summed = v_out_sum = i_out_sum = 0;
+    swtimer_start(&sample_timer, CONFIG_CHART_INTERVAL, CONFIG_CHART_INTERVAL);
+}
+
+/**
+ * @brief      Remove the scrolled chart before the next screen is drawn
+ */
+static void deactivated(void)
+{
+    swtimer_stop(&sample_timer);
+    tft_clear();
+}
+
+/**
+ * @brief      Add the current measurements to the ones averaged into the next
+ *             column
+ */
+static void sum_measurements(void)
+{
+    uint16_t i_out_raw, v_in_raw, v_out_raw;
+    hw_get_adc_values(&i_out_raw, &v_in_raw, &v_out_raw);
+    (void) v_in_raw;
+
+    v_out_sum += pwrctl_calc_vout(v_out_raw);
+    i_out_sum += pwrctl_calc_iout(i_out_raw);
+    num_summed++;
+}
+
+/**
+ * @brief      Average the measurements that arrived since the last column
+ */
+static void chart_tick(void)
+{
+    sum_measurements();
+}
+
+/**
+ * @brief      Add a column to the chart, averaging the measurements since the
+ *             last one and the current one
+ *
+ * @param      timer  The sample timer
+ */
+static void sample_fired(swtimer_t *timer)
+{
+    (void) timer;
+    sum_measurements();
+    uint32_t values[UI_CHART_TRACES] = { v_out_sum / num_summed, i_out_sum / num_summed };
+    chart_add(&chart_plot, values);
+    num_summed = v_out_sum = i_out_sum = 0;
+}
+
+/**
+ * @brief      Initialise the chart module and add its screen to the UI
+ *
+ * @param      ui    The user interface
+ */
+void settings_chart_init(uui_t *ui)
+{
+    chart_init(&chart_plot);
+    uui_add_screen(ui, &chart_screen);
+}
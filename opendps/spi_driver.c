@@ -28,6 +28,7 @@
 #include <nvic.h>
 #include <spi.h>
 #include <errno.h>
+#include <string.h>
 #include "spi_driver.h"
 #include "hw.h"
 
@@ -40,9 +41,59 @@ typedef enum {
 
 static volatile spi_status_t dma_status;
 
+/** Kinds of queued display transfers */
+typedef enum {
+    spi_job_bytes = 0, /** A buffer sent by DMA */
+    spi_job_commands, /** A command list sent by polling */
+    spi_job_words, /** A buffer of 16 bit words sent by DMA */
+    spi_job_fill /** A single 16 bit word sent len times by DMA */
+} spi_job_type_t;
+
+/** A display transfer waiting in the DMA queue */
+typedef struct {
+    spi_job_type_t type;
+    const uint8_t *buf;
+    uint16_t len; /** Bytes, or 16 bit words for words and fills */
+    uint16_t repeat; /** Number of times the buffer is still to be sent */
+    uint16_t fill; /** The word sent by fills */
+    bool data; /** Level of the TFT A0 pin */
+    uint8_t inline_buf[SPI_DMA_INLINE_SIZE]; /** Storage for copied transfers */
+} spi_job_t;
+
+/** The queue is written by the main loop at the head and retired by the TX
+    DMA complete ISR at the tail, the indices wrap at 256 */
+static spi_job_t queue[SPI_DMA_QUEUE_SIZE];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+static volatile bool queue_running;
+static bool a0_level;
+static bool a0_valid;
+static uint32_t bytes_queued; /** Bytes put on the bus by queued transfers, wraps */
+static bool spi_16bit;
+
+static void spi_set_frame_size(bool sixteen);
+
 /** The DPS5005 has NSS grounded meaning we do not have to toggle it */
 #define SPI_NSS_GROUNDED
 
+/** SPI2 is clocked by APB1, which runs at half the 48MHz system clock */
+#define SPI_PCLK_HZ (24000000)
+
+/** The ILI9163C serial write cycle is min 66ns */
+#define ILI9163C_MAX_SCK_HZ (15000000)
+
+#ifndef CONFIG_SPI_CLOCK_DIV
+ #define CONFIG_SPI_CLOCK_DIV 2
+#endif
+
+#if SPI_PCLK_HZ / CONFIG_SPI_CLOCK_DIV > ILI9163C_MAX_SCK_HZ
+ #error "CONFIG_SPI_CLOCK_DIV clocks the SPI faster than the ILI9163C can take"
+#endif
+
+/** Maps CONFIG_SPI_CLOCK_DIV (2, 4, 8 ... 256) to the SPI baud rate setting */
+#define _SPI_BAUDRATE(div) SPI_CR1_BAUDRATE_FPCLK_DIV_##div
+#define SPI_BAUDRATE(div) _SPI_BAUDRATE(div)
+
 /**
   * @brief Initialize the SPI driver
   * @retval None
@@ -50,13 +101,16 @@ static volatile spi_status_t dma_status;
 void spi_init(void)
 {
     dma_status = spi_idle;
+    queue_head = queue_tail = 0;
+    queue_running = false;
+    spi_16bit = false;
 
     rcc_periph_clock_enable(RCC_SPI2);
     rcc_periph_clock_enable(RCC_DMA1);
     rcc_periph_reset_hold(RST_SPI2);
     rcc_periph_reset_release(RST_SPI2);
     SPI2_I2SCFGR = 0;
-    spi_init_master(SPI2, SPI_CR1_BAUDRATE_FPCLK_DIV_2, SPI_CR1_CPOL_CLK_TO_1_WHEN_IDLE, SPI_CR1_CPHA_CLK_TRANSITION_2, SPI_CR1_DFF_8BIT, SPI_CR1_MSBFIRST);
+    spi_init_master(SPI2, SPI_BAUDRATE(CONFIG_SPI_CLOCK_DIV), SPI_CR1_CPOL_CLK_TO_1_WHEN_IDLE, SPI_CR1_CPHA_CLK_TRANSITION_2, SPI_CR1_DFF_8BIT, SPI_CR1_MSBFIRST);
 
     spi_enable_software_slave_management(SPI2);
     spi_set_nss_high(SPI2);
@@ -82,6 +136,9 @@ bool spi_dma_transceive(uint8_t *tx_buf, uint32_t tx_len, uint8_t *rx_buf, uint3
         return false;
     }
 
+    spi_dma_fence();
+    spi_set_frame_size(false);
+
     dma_channel_reset(DMA1, DMA_CHANNEL4);
     dma_channel_reset(DMA1, DMA_CHANNEL5);
 
@@ -116,9 +173,6 @@ bool spi_dma_transceive(uint8_t *tx_buf, uint32_t tx_len, uint8_t *rx_buf, uint3
         dma_set_memory_address(DMA1, DMA_CHANNEL5, (uint32_t)tx_buf);
         dma_set_number_of_data(DMA1, DMA_CHANNEL5, tx_len);
         dma_set_read_from_memory(DMA1, DMA_CHANNEL5);
-        dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL5);
-        dma_set_peripheral_size(DMA1, DMA_CHANNEL5, DMA_CCR_PSIZE_8BIT);
-        dma_set_memory_size(DMA1, DMA_CHANNEL5, DMA_CCR_MSIZE_8BIT);
         dma_set_priority(DMA1, DMA_CHANNEL5, DMA_CCR_PL_HIGH);
         dma_enable_transfer_complete_interrupt(DMA1, DMA_CHANNEL5);
         dma_enable_channel(DMA1, DMA_CHANNEL5);
@@ -153,6 +207,364 @@ bool spi_dma_transceive(uint8_t *tx_buf, uint32_t tx_len, uint8_t *rx_buf, uint3
     return true;
 }
 
+/**
+  * @brief Wait for the last byte to leave the SPI shift register
+  * @retval None
+  */
+static void spi_wait_idle(void)
+{
+    while (!(SPI_SR(SPI2) & SPI_SR_TXE)) ;
+    while (SPI_SR(SPI2) & SPI_SR_BSY) ;
+}
+
+/**
+  * @brief Set the TFT A0 pin once the SPI is done with the previous byte
+  * @param level true for data and false for commands
+  * @retval None
+  */
+static void spi_set_a0(bool level)
+{
+    if (!a0_valid || level != a0_level) {
+        /** The display samples A0 with the last bit of each byte */
+        spi_wait_idle();
+        if (level) {
+            gpio_set(TFT_A0_PORT, TFT_A0_PIN);
+        } else {
+            gpio_clear(TFT_A0_PORT, TFT_A0_PIN);
+        }
+        a0_level = level;
+        a0_valid = true;
+    }
+}
+
+/**
+  * @brief Switch between 8 and 16 bit SPI frames, the SPI must be disabled
+  *        while the frame format changes
+  * @param sixteen true for 16 bit frames
+  * @retval None
+  */
+static void spi_set_frame_size(bool sixteen)
+{
+    if (sixteen != spi_16bit) {
+        spi_wait_idle();
+        spi_disable(SPI2);
+        if (sixteen) {
+            spi_set_dff_16bit(SPI2);
+        } else {
+            spi_set_dff_8bit(SPI2);
+        }
+        spi_enable(SPI2);
+        spi_16bit = sixteen;
+    }
+}
+
+/**
+  * @brief Start the TX DMA for a queued transfer
+  * @param job the transfer
+  * @retval None
+  */
+static void spi_start_dma(spi_job_t *job)
+{
+    bool sixteen = job->type == spi_job_words || job->type == spi_job_fill;
+    spi_set_a0(job->data);
+    spi_set_frame_size(sixteen);
+    dma_disable_channel(DMA1, DMA_CHANNEL5);
+    if (job->type == spi_job_fill) {
+        /** Send the same word over and over in 16 bit frames */
+        dma_disable_memory_increment_mode(DMA1, DMA_CHANNEL5);
+        dma_set_peripheral_size(DMA1, DMA_CHANNEL5, DMA_CCR_PSIZE_16BIT);
+        dma_set_memory_size(DMA1, DMA_CHANNEL5, DMA_CCR_MSIZE_16BIT);
+        dma_set_memory_address(DMA1, DMA_CHANNEL5, (uint32_t)&job->fill);
+    } else if (sixteen) {
+        dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL5);
+        dma_set_peripheral_size(DMA1, DMA_CHANNEL5, DMA_CCR_PSIZE_16BIT);
+        dma_set_memory_size(DMA1, DMA_CHANNEL5, DMA_CCR_MSIZE_16BIT);
+        dma_set_memory_address(DMA1, DMA_CHANNEL5, (uint32_t)job->buf);
+    } else {
+        dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL5);
+        dma_set_peripheral_size(DMA1, DMA_CHANNEL5, DMA_CCR_PSIZE_8BIT);
+        dma_set_memory_size(DMA1, DMA_CHANNEL5, DMA_CCR_MSIZE_8BIT);
+        dma_set_memory_address(DMA1, DMA_CHANNEL5, (uint32_t)job->buf);
+    }
+    dma_set_number_of_data(DMA1, DMA_CHANNEL5, job->len);
+    dma_enable_channel(DMA1, DMA_CHANNEL5);
+}
+
+/**
+  * @brief Send a command list by polling the SPI, the list is a sequence of
+  *        [<command>] [<num data bytes>] [<data>]*
+  * @param job the transfer
+  * @retval None
+  */
+static void spi_send_commands(spi_job_t *job)
+{
+    const uint8_t *p = job->buf;
+    const uint8_t *end = p + job->len;
+    dma_disable_channel(DMA1, DMA_CHANNEL5);
+    spi_set_frame_size(false);
+    while (p < end) {
+        spi_set_a0(false);
+        SPI_DR(SPI2) = *p++;
+        uint8_t len = *p++;
+        if (len) {
+            spi_set_a0(true);
+            while (len--) {
+                while (!(SPI_SR(SPI2) & SPI_SR_TXE)) ;
+                SPI_DR(SPI2) = *p++;
+            }
+        }
+    }
+}
+
+/**
+  * @brief Start queued transfers from the tail until one is running on the DMA
+  *        or the queue is empty
+  * @retval None
+  */
+static void spi_queue_kick(void)
+{
+    while (queue_tail != queue_head) {
+        spi_job_t *job = &queue[queue_tail % SPI_DMA_QUEUE_SIZE];
+        if (job->type != spi_job_commands) {
+            spi_start_dma(job);
+            return;
+        }
+        spi_send_commands(job);
+        queue_tail++;
+    }
+    dma_disable_transfer_complete_interrupt(DMA1, DMA_CHANNEL5);
+    dma_disable_channel(DMA1, DMA_CHANNEL5);
+    spi_disable_tx_dma(SPI2);
+    spi_wait_idle();
+#ifdef TFT_CSN_PORT
+    gpio_set(TFT_CSN_PORT, TFT_CSN_PIN);
+#endif
+    queue_running = false;
+}
+
+/**
+  * @brief Retire the current transfer and chain the next one, called from the TX DMA ISR
+  * @retval None
+  */
+static void spi_queue_next(void)
+{
+    spi_job_t *job = &queue[queue_tail % SPI_DMA_QUEUE_SIZE];
+    if (--job->repeat == 0) {
+        queue_tail++;
+        spi_queue_kick();
+    } else {
+        spi_start_dma(job);
+    }
+}
+
+/**
+  * @brief Get a free slot at the head of the queue, waits for the DMA if the queue is full
+  * @retval the slot
+  */
+static spi_job_t *spi_queue_alloc(void)
+{
+    while ((uint8_t)(queue_head - queue_tail) == SPI_DMA_QUEUE_SIZE) ;
+    return &queue[queue_head % SPI_DMA_QUEUE_SIZE];
+}
+
+/**
+  * @brief Publish the slot at the head of the queue and start the DMA if it is idle
+  * @retval None
+  */
+static void spi_queue_commit(void)
+{
+    nvic_disable_irq(NVIC_DMA1_CHANNEL5_IRQ);
+    queue_head++;
+    if (!queue_running) {
+        queue_running = true;
+        dma_channel_reset(DMA1, DMA_CHANNEL5);
+        dma_set_peripheral_address(DMA1, DMA_CHANNEL5, (uint32_t)&SPI2_DR);
+        dma_set_read_from_memory(DMA1, DMA_CHANNEL5);
+        dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL5);
+        dma_set_peripheral_size(DMA1, DMA_CHANNEL5, DMA_CCR_PSIZE_8BIT);
+        dma_set_memory_size(DMA1, DMA_CHANNEL5, DMA_CCR_MSIZE_8BIT);
+        dma_set_priority(DMA1, DMA_CHANNEL5, DMA_CCR_PL_HIGH);
+        dma_enable_transfer_complete_interrupt(DMA1, DMA_CHANNEL5);
+#ifdef TFT_CSN_PORT
+        gpio_clear(TFT_CSN_PORT, TFT_CSN_PIN);
+#endif
+        a0_valid = false;
+        spi_enable_tx_dma(SPI2);
+        spi_queue_kick();
+    }
+    nvic_enable_irq(NVIC_DMA1_CHANNEL5_IRQ);
+}
+
+/**
+  * @brief Queue a display transfer, the buffer is sent by DMA in the background
+  * @param tx_buf transmit buffer, must remain valid until the transfer is done
+  * @param tx_len transmit buffer size (max 65535)
+  * @param repeat number of times the buffer is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue(const uint8_t *tx_buf, uint32_t tx_len, uint32_t repeat, bool data)
+{
+    if (!tx_buf || !tx_len || tx_len > 0xffff || !repeat || repeat > 0xffff) {
+        return false;
+    }
+    spi_job_t *job = spi_queue_alloc();
+    job->buf = tx_buf;
+    job->len = tx_len;
+    job->repeat = repeat;
+    job->data = data;
+    job->type = spi_job_bytes;
+    spi_queue_commit();
+    bytes_queued += tx_len * repeat;
+    return true;
+}
+
+/**
+  * @brief Queue a display transfer of a small buffer that is copied to the queue
+  * @param tx_buf transmit buffer, may be reused when the function returns
+  * @param tx_len transmit buffer size (max SPI_DMA_INLINE_SIZE)
+  * @param repeat number of times the buffer is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_copy(const uint8_t *tx_buf, uint32_t tx_len, uint32_t repeat, bool data)
+{
+    if (!tx_buf || !tx_len || tx_len > SPI_DMA_INLINE_SIZE || !repeat || repeat > 0xffff) {
+        return false;
+    }
+    spi_job_t *job = spi_queue_alloc();
+    memcpy(job->inline_buf, tx_buf, tx_len);
+    job->buf = job->inline_buf;
+    job->len = tx_len;
+    job->repeat = repeat;
+    job->data = data;
+    job->type = spi_job_bytes;
+    spi_queue_commit();
+    bytes_queued += tx_len * repeat;
+    return true;
+}
+
+/**
+  * @brief Queue a display transfer of 16 bit words sent in 16 bit SPI frames,
+  *        most significant byte first, so the words need no byte swapping
+  * @param tx_buf the words, must remain valid until the transfer is done
+  * @param count number of words (max 65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue16(const uint16_t *tx_buf, uint32_t count, bool data)
+{
+    if (!tx_buf || !count || count > 0xffff) {
+        return false;
+    }
+    spi_job_t *job = spi_queue_alloc();
+    job->buf = (const uint8_t*) tx_buf;
+    job->len = count;
+    job->repeat = 1;
+    job->data = data;
+    job->type = spi_job_words;
+    spi_queue_commit();
+    bytes_queued += 2 * count;
+    return true;
+}
+
+/**
+  * @brief Queue a fill, a 16 bit word sent a number of times in one transfer
+  *        without memory increment
+  * @param word the word, sent most significant byte first
+  * @param count number of times the word is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the fill was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_fill(uint16_t word, uint32_t count, bool data)
+{
+    if (!count || count > 0xffff) {
+        return false;
+    }
+    spi_job_t *job = spi_queue_alloc();
+    job->fill = word;
+    job->buf = 0;
+    job->len = count;
+    job->repeat = 1;
+    job->data = data;
+    job->type = spi_job_fill;
+    spi_queue_commit();
+    bytes_queued += 2 * count;
+    return true;
+}
+
+/**
+  * @brief Queue a display command list that is copied to the queue
+  * @param list the command list, a sequence of [<command>] [<num data bytes>] [<data>]*
+  * @param len size of the list (max SPI_DMA_INLINE_SIZE)
+  * @retval true if the list was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_commands(const uint8_t *list, uint32_t len)
+{
+    if (!list || !len || len > SPI_DMA_INLINE_SIZE) {
+        return false;
+    }
+    spi_job_t *job = spi_queue_alloc();
+    memcpy(job->inline_buf, list, len);
+    job->buf = job->inline_buf;
+    job->len = len;
+    job->repeat = 1;
+    job->data = false;
+    job->type = spi_job_commands;
+    spi_queue_commit();
+    /** The data byte counts of the list are not sent */
+    for (uint32_t i = 0; i + 1 < len; i += 2 + list[i + 1]) {
+        bytes_queued += 1 + list[i + 1];
+    }
+    return true;
+}
+
+/**
+  * @brief Get the number of bytes queued for the display since start up
+  * @retval the byte count, wraps at 2^32
+  */
+uint32_t spi_dma_bytes_queued(void)
+{
+    return bytes_queued;
+}
+
+/**
+  * @brief Wait for all queued transfers to complete
+  * @retval None
+  */
+void spi_dma_fence(void)
+{
+    while (queue_running) ;
+}
+
+/**
+  * @brief Get a marker for the transfers queued so far
+  * @retval the marker, to be passed to spi_dma_wait(...)
+  */
+uint8_t spi_dma_marker(void)
+{
+    return queue_head;
+}
+
+/**
+  * @brief Wait for the transfers queued before a marker was taken to complete,
+  *        later transfers may still be running
+  * @param marker the marker from spi_dma_marker()
+  * @retval None
+  * @note A marker more than 256 transfers old may wait for more than needed
+  */
+void spi_dma_wait(uint8_t marker)
+{
+    /** The transfers before the marker are done once no more than the ones
+        queued after it are pending */
+    while ((uint8_t)(queue_head - queue_tail) > (uint8_t)(queue_head - marker)) ;
+}
+
 /**
   * @brief SPI RX DMA handler
   * @retval None
@@ -177,6 +589,11 @@ void dma1_channel5_isr(void)
     if ((DMA1_ISR &DMA_ISR_TCIF3) != 0) {
         DMA1_IFCR |= DMA_IFCR_CTCIF3;
     }
+    if (queue_running) {
+        dma_clear_interrupt_flags(DMA1, DMA_CHANNEL5, DMA_TCIF);
+        spi_queue_next();
+        return;
+    }
     dma_disable_transfer_complete_interrupt(DMA1, DMA_CHANNEL5);
     spi_disable_tx_dma(SPI2);
     dma_disable_channel(DMA1, DMA_CHANNEL5);
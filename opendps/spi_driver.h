@@ -25,6 +25,12 @@
 #ifndef __SPI_DRIVER_H__
 #define __SPI_DRIVER_H__
 
+/** Number of display transfers that can be queued */
+#define SPI_DMA_QUEUE_SIZE  (16)
+
+/** Max size of a transfer copied into the queue */
+#define SPI_DMA_INLINE_SIZE (16)
+
 /**
   * @brief Initialize the SPI driver
   * @retval None
@@ -42,4 +48,85 @@ void spi_init(void);
   */
 bool spi_dma_transceive(uint8_t *tx_buf, uint32_t tx_len, uint8_t *rx_buf, uint32_t rx_len);
 
+/**
+  * @brief Queue a display transfer, the buffer is sent by DMA in the background
+  * @param tx_buf transmit buffer, must remain valid until the transfer is done
+  * @param tx_len transmit buffer size (max 65535)
+  * @param repeat number of times the buffer is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue(const uint8_t *tx_buf, uint32_t tx_len, uint32_t repeat, bool data);
+
+/**
+  * @brief Queue a display transfer of a small buffer that is copied to the queue
+  * @param tx_buf transmit buffer, may be reused when the function returns
+  * @param tx_len transmit buffer size (max SPI_DMA_INLINE_SIZE)
+  * @param repeat number of times the buffer is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_copy(const uint8_t *tx_buf, uint32_t tx_len, uint32_t repeat, bool data);
+
+/**
+  * @brief Queue a display transfer of 16 bit words sent in 16 bit SPI frames,
+  *        most significant byte first, so the words need no byte swapping
+  * @param tx_buf the words, must remain valid until the transfer is done
+  * @param count number of words (max 65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the transfer was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue16(const uint16_t *tx_buf, uint32_t count, bool data);
+
+/**
+  * @brief Queue a fill, a 16 bit word sent a number of times in one transfer
+  *        without memory increment
+  * @param word the word, sent most significant byte first
+  * @param count number of times the word is sent (1..65535)
+  * @param data level of the TFT A0 pin, true for data and false for commands
+  * @retval true if the fill was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_fill(uint16_t word, uint32_t count, bool data);
+
+/**
+  * @brief Queue a display command list that is copied to the queue. The list is
+  *        sent by polling the SPI when it reaches the head of the queue, which is
+  *        cheaper than one DMA transfer per command and argument.
+  * @param list the command list, a sequence of [<command>] [<num data bytes>] [<data>]*
+  * @param len size of the list (max SPI_DMA_INLINE_SIZE)
+  * @retval true if the list was queued
+  *         false if parameter error
+  */
+bool spi_dma_queue_commands(const uint8_t *list, uint32_t len);
+
+/**
+  * @brief Get the number of bytes queued for the display since start up
+  * @retval the byte count, wraps at 2^32
+  */
+uint32_t spi_dma_bytes_queued(void);
+
+/**
+  * @brief Wait for all queued transfers to complete
+  * @retval None
+  */
+void spi_dma_fence(void);
+
+/**
+  * @brief Get a marker for the transfers queued so far
+  * @retval the marker, to be passed to spi_dma_wait(...)
+  */
+uint8_t spi_dma_marker(void);
+
+/**
+  * @brief Wait for the transfers queued before a marker was taken to complete,
+  *        later transfers may still be running
+  * @param marker the marker from spi_dma_marker()
+  * @retval None
+  */
+void spi_dma_wait(uint8_t marker);
+
 #endif // __SPI_DRIVER_H__
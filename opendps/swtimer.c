@@ -0,0 +1,163 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#ifndef DPS_EMULATOR
+#include <cortex.h>
+#endif // DPS_EMULATOR
+#include "tick.h"
+#include "swtimer.h"
+
+/** Running timers sorted by deadline, the first one fires next */
+static swtimer_t *timers;
+
+/** The list is changed by ISRs starting and stopping timers */
+#ifdef DPS_EMULATOR
+ #define LOCK() (void) 0
+ #define UNLOCK() (void) 0
+#else // DPS_EMULATOR
+ #define LOCK() uint32_t masked = cm_mask_interrupts(1)
+ #define UNLOCK() cm_mask_interrupts(masked)
+#endif // DPS_EMULATOR
+
+/**
+  * @brief Remove a timer from the list, call with interrupts masked
+  * @param timer the timer
+  * @retval none
+  */
+static void unlink_timer(swtimer_t *timer)
+{
+    for (swtimer_t **p = &timers; *p; p = &(*p)->next) {
+        if (*p == timer) {
+            *p = timer->next;
+            break;
+        }
+    }
+    timer->is_active = false;
+}
+
+/**
+  * @brief Insert a timer after the timers with the same or an earlier
+  *        deadline, call with interrupts masked
+  * @param timer the timer
+  * @retval none
+  */
+static void link_timer(swtimer_t *timer)
+{
+    swtimer_t **p = &timers;
+    while (*p && (*p)->deadline <= timer->deadline) {
+        p = &(*p)->next;
+    }
+    timer->next = *p;
+    *p = timer;
+    timer->is_active = true;
+}
+
+/**
+  * @brief Start a timer, a running timer is restarted
+  * @param timer the timer, with the callback set
+  * @param delay time in ms until the timer fires
+  * @param period time in ms between the following firings, 0 for a one-shot
+  *        timer
+  * @retval none
+  */
+void swtimer_start(swtimer_t *timer, uint32_t delay, uint32_t period)
+{
+    uint64_t now = get_ticks();
+    LOCK();
+    if (timer->is_active) {
+        unlink_timer(timer);
+    }
+    timer->deadline = now + delay;
+    timer->period = period;
+    link_timer(timer);
+    UNLOCK();
+}
+
+/**
+  * @brief Stop a timer, stopping a stopped timer is fine
+  * @param timer the timer
+  * @retval none
+  */
+void swtimer_stop(swtimer_t *timer)
+{
+    LOCK();
+    if (timer->is_active) {
+        unlink_timer(timer);
+    }
+    UNLOCK();
+}
+
+/**
+  * @brief Run the callbacks of the timers that are due, periodic timers are
+  *        restarted before their callback is called. Call from the main loop.
+  * @retval none
+  */
+void swtimer_run(void)
+{
+    uint64_t now = get_ticks();
+    while (1) {
+        swtimer_t *timer;
+        {
+            LOCK();
+            timer = timers;
+            if (timer && timer->deadline <= now) {
+                timers = timer->next;
+                timer->is_active = false;
+                if (timer->period) {
+                    /** Keep the phase unless the loop fell a full period behind */
+                    timer->deadline += timer->period;
+                    if (timer->deadline <= now) {
+                        timer->deadline = now + timer->period;
+                    }
+                    link_timer(timer);
+                }
+            } else {
+                timer = NULL;
+            }
+            UNLOCK();
+        }
+        if (!timer) {
+            break;
+        }
+        timer->callback(timer);
+    }
+}
+
+/**
+  * @brief Get the deadline of the next timer to fire
+  * @retval time in ms or SWTIMER_NO_DEADLINE
+  */
+uint64_t swtimer_next_deadline(void)
+{
+    uint64_t deadline = SWTIMER_NO_DEADLINE;
+    LOCK();
+    if (timers) {
+        deadline = timers->deadline;
+    }
+    UNLOCK();
+    return deadline;
+}
@@ -0,0 +1,82 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __SWTIMER_H__
+#define __SWTIMER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Software timers - one-shot and periodic millisecond timers run from the
+ * main loop. The timers are owned by their users, usually as static
+ * variables, and kept in a list sorted by deadline so finding the next
+ * deadline and the timers that are due is cheap. Timers may be started and
+ * stopped from ISRs, the callbacks always run in the main loop.
+ */
+
+/** Returned by swtimer_next_deadline() when no timer is running */
+#define SWTIMER_NO_DEADLINE  (UINT64_MAX)
+
+typedef struct swtimer swtimer_t;
+
+struct swtimer {
+    void (*callback)(swtimer_t *timer); /** Called when the timer fires */
+    uint32_t period; /** Period in ms, 0 for one-shot timers */
+    uint64_t deadline; /** Time in ms the timer fires */
+    bool is_active;
+    swtimer_t *next;
+};
+
+/**
+  * @brief Start a timer, a running timer is restarted
+  * @param timer the timer, with the callback set
+  * @param delay time in ms until the timer fires
+  * @param period time in ms between the following firings, 0 for a one-shot
+  *        timer
+  * @retval none
+  */
+void swtimer_start(swtimer_t *timer, uint32_t delay, uint32_t period);
+
+/**
+  * @brief Stop a timer, stopping a stopped timer is fine
+  * @param timer the timer
+  * @retval none
+  */
+void swtimer_stop(swtimer_t *timer);
+
+/**
+  * @brief Run the callbacks of the timers that are due, periodic timers are
+  *        restarted before their callback is called. Call from the main loop.
+  * @retval none
+  */
+void swtimer_run(void);
+
+/**
+  * @brief Get the deadline of the next timer to fire
+  * @retval time in ms or SWTIMER_NO_DEADLINE
+  */
+uint64_t swtimer_next_deadline(void);
+
+#endif // __SWTIMER_H__
@@ -1,138 +1,387 @@
 #include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dds.h"
+#include "flash.h"
+#include "past.h"
+#include "pastunits.h"
+#include "func_gen.h"
 
-typedef unsigned int uint32_t;
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+/** Largest allowed difference between the requested and the generated frequency */
+#define MAX_FREQUENCY_ERROR  (0.001)
+/** Amplitude of the test waveforms (mV) */
+#define TEST_MAX_MV  (10000)
 
 /**
- * @brief      Compute a square signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
+ * @brief      Amplitude of one frequency bin of the buffer, DC removed
  */
-static int32_t square_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
+static double bin_amplitude(const uint16_t *buffer, uint32_t bin)
 {
-    if (!period_in_us) return max;
-    /** The time is ticking at 1000000Hz so a unit is 1us. The production is 1 for t in [(t%T) ; (t%T+T/2)], 0 otherwise */
-    uint32_t t = time_in_us % period_in_us;
-    return t <= period_in_us / 2 ? max : 0;
+    double mean = 0, re = 0, im = 0;
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        mean += buffer[i];
+    }
+    mean /= DDS_BUFFER_SIZE;
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        double angle = 2 * M_PI * bin * i / DDS_BUFFER_SIZE;
+        re += (buffer[i] - mean) * cos(angle);
+        im -= (buffer[i] - mean) * sin(angle);
+    }
+    return sqrt(re * re + im * im);
 }
 
 /**
- * @brief      Compute a saw signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
+ * @brief      Total harmonic distortion of a buffer holding 'cycles' cycles,
+ *             counting all harmonics below the Nyquist frequency
  */
-static int32_t saw_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
+static double thd(const uint16_t *buffer, uint32_t cycles)
 {
-    if (!period_in_us) return max;
-    /** The time is ticking at 1000000Hz so a unit is 1us. The production is (max*(t%T))/T */
-    uint32_t t = time_in_us % period_in_us;
-    return (t * max) / period_in_us;
+    double harmonics = 0;
+    for (uint32_t bin = 2 * cycles; bin < DDS_BUFFER_SIZE / 2; bin += cycles) {
+        double a = bin_amplitude(buffer, bin);
+        harmonics += a * a;
+    }
+    return sqrt(harmonics) / bin_amplitude(buffer, cycles);
+}
+
+static bool test_plan_range(void)
+{
+    dds_plan_t plan;
+    return !dds_plan(0, &plan) && !dds_plan(DDS_MAX_FREQUENCY + 1, &plan) &&
+           dds_plan(1, &plan) && dds_plan(DDS_MAX_FREQUENCY, &plan);
+}
+
+static bool test_frequency_accuracy(void)
+{
+    double worst = 0;
+    for (uint32_t freq = 1; freq <= DDS_MAX_FREQUENCY; freq++) {
+        dds_plan_t plan;
+        if (!dds_plan(freq, &plan)) {
+            printf("  %u dHz: no plan\n", freq);
+            return false;
+        }
+        double divider = (double) (plan.prescaler + 1) * (plan.period + 1);
+        double sample_rate = DDS_TIMER_CLOCK / divider;
+        double actual = 10 * sample_rate * plan.cycles / DDS_BUFFER_SIZE;
+        double error = fabs(actual / freq - 1);
+        if (plan.prescaler > 0xffff || plan.period > 0xffff || plan.cycles == 0 ||
+            DDS_BUFFER_SIZE / plan.cycles < DDS_MIN_CYCLE_SAMPLES ||
+            sample_rate > DDS_MAX_SAMPLE_RATE || error > MAX_FREQUENCY_ERROR) {
+            printf("  %u dHz: cycles %u divider %.0f gives %.3f dHz\n", freq, plan.cycles, divider, actual);
+            return false;
+        }
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    printf("  worst frequency error %.4f%%\n", 100 * worst);
+    return true;
+}
+
+static bool test_table_frequency(void)
+{
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    for (uint32_t wave = dds_square; wave <= dds_sine; wave++) {
+        for (uint32_t cycles = 1; cycles <= DDS_BUFFER_SIZE / DDS_MIN_CYCLE_SAMPLES; cycles++) {
+            dds_fill(buffer, wave, TEST_MAX_MV, cycles);
+            /** The strongest bin is the fundamental */
+            double fundamental = bin_amplitude(buffer, cycles);
+            for (uint32_t bin = 1; bin < DDS_BUFFER_SIZE / 2; bin++) {
+                if (bin != cycles && bin_amplitude(buffer, bin) >= fundamental) {
+                    printf("  wave %u cycles %u: bin %u\n", wave, cycles, bin);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static bool test_range(void)
+{
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    for (uint32_t wave = dds_square; wave <= dds_sine; wave++) {
+        dds_fill(buffer, wave, TEST_MAX_MV, 1);
+        uint16_t min = 0xffff, max = 0;
+        for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+            min = buffer[i] < min ? buffer[i] : min;
+            max = buffer[i] > max ? buffer[i] : max;
+        }
+        /** The saw never quite reaches the top */
+        if (min > TEST_MAX_MV / 100 || max > TEST_MAX_MV || max < TEST_MAX_MV - TEST_MAX_MV / 50) {
+            printf("  wave %u: %u to %u mV\n", wave, min, max);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_sine_thd(void)
+{
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    double worst = 0;
+    for (uint32_t cycles = 1; cycles <= DDS_BUFFER_SIZE / DDS_MIN_CYCLE_SAMPLES; cycles++) {
+        dds_fill(buffer, dds_sine, TEST_MAX_MV, cycles);
+        double d = thd(buffer, cycles);
+        if (d > worst) {
+            worst = d;
+        }
+    }
+    printf("  worst sine THD %.4f%%\n", 100 * worst);
+    return worst < 0.001;
+}
+
+static bool test_square_saw_thd(void)
+{
+    /** The THD of the ideal waveforms is 48.3% and 80.3%, sampling leaves
+        out the harmonics above the Nyquist frequency */
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    dds_fill(buffer, dds_square, TEST_MAX_MV, 1);
+    double square = thd(buffer, 1);
+    dds_fill(buffer, dds_saw, TEST_MAX_MV, 1);
+    double saw = thd(buffer, 1);
+    printf("  square THD %.1f%%, saw THD %.1f%%\n", 100 * square, 100 * saw);
+    return fabs(square - 0.483) < 0.02 && fabs(saw - 0.803) < 0.03;
+}
+
+static bool test_table_points(void)
+{
+    /** A table of one point per sample is played as is */
+    uint16_t table[DDS_BUFFER_SIZE], buffer[DDS_BUFFER_SIZE];
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        table[i] = (i * 7919) % TEST_MAX_MV;
+    }
+    dds_fill_table(buffer, table, DDS_BUFFER_SIZE, TEST_MAX_MV, 1);
+    return memcmp(table, buffer, sizeof(buffer)) == 0;
+}
+
+static bool test_table_interpolation(void)
+{
+    /** Two cycles of a 4 point table, 32 samples between two points,
+        wrapping back to the first point at the end of each cycle */
+    const uint16_t table[] = { 0, 3200, 1600, 6400 };
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    dds_fill_table(buffer, table, 4, TEST_MAX_MV, 2);
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        uint32_t point = (i / 32) % 4;
+        int32_t from = table[point], to = table[(point + 1) % 4];
+        int32_t expected = from + (to - from) * (int32_t) (i % 32) / 32;
+        if (abs(buffer[i] - expected) > 1) {
+            printf("  sample %u is %u mV, expected %d mV\n", i, buffer[i], expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_table_clipping(void)
+{
+    const uint16_t table[] = { 0, 65535, 20000 };
+    uint16_t buffer[DDS_BUFFER_SIZE];
+    dds_fill_table(buffer, table, 3, 10000, 16);
+    uint16_t max = 0;
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        max = buffer[i] > max ? buffer[i] : max;
+    }
+    return max == 10000;
+}
+
+static bool test_upload_order(void)
+{
+    static dds_upload_t upload;
+    uint16_t points[8] = { 100, 200, 300, 400, 500, 600, 700, 800 };
+    /** A complete upload in order */
+    if (!dds_upload_write(&upload, 8, 0, points, 4) || dds_upload_complete(&upload) ||
+        !dds_upload_write(&upload, 8, 4, &points[4], 4) || !dds_upload_complete(&upload) ||
+        memcmp(upload.mv, points, sizeof(points))) {
+        return false;
+    }
+    /** Only the last chunk, or any chunk without a preceding offset 0 chunk */
+    if (dds_upload_write(&upload, 8, 4, &points[4], 4) || dds_upload_complete(&upload)) {
+        return false;
+    }
+    /** Skipped, repeated and resized chunks are refused */
+    if (!dds_upload_write(&upload, 8, 0, points, 2) ||
+        dds_upload_write(&upload, 8, 4, &points[4], 4) ||
+        !dds_upload_write(&upload, 8, 2, &points[2], 2) ||
+        dds_upload_write(&upload, 8, 2, &points[2], 2) ||
+        dds_upload_write(&upload, 6, 4, &points[4], 2) ||
+        dds_upload_complete(&upload)) {
+        return false;
+    }
+    /** An aborted upload never completes, a new one starts over at 0 */
+    if (!dds_upload_write(&upload, 4, 0, points, 2) || dds_upload_complete(&upload) ||
+        !dds_upload_write(&upload, 4, 2, &points[2], 2) || !dds_upload_complete(&upload)) {
+        return false;
+    }
+    return dds_upload_write(&upload, 2, 0, points, 3) == false && !dds_upload_complete(&upload);
+}
+
+/** Simulated past flash blocks, in the 32 bit address space like past_test */
+static uint8_t past_block1[1024] __attribute__((aligned(4)));
+static uint8_t past_block2[1024] __attribute__((aligned(4)));
+
+void lock_flash(void) {}
+void unlock_flash(void) {}
+
+void flash_erase_page(uint32_t address)
+{
+    memset((char*) address, 0xff, 1024);
+}
+
+void flash_program_word(uint32_t address, uint32_t data)
+{
+    *((uint32_t*) address) = data;
+}
+
+uint32_t flash_get_status_flags(void)
+{
+    return FLASH_SR_EOP;
 }
 
-/*
- * The number of bits of our data type: here 16 (sizeof operator returns bytes).
- */
-#define INT16_BITS  (8 * sizeof(int16_t))
-#ifndef INT16_MAX
-#define INT16_MAX   ((1<<(INT16_BITS-1))-1)
-#endif
- 
-/*
- * "5 bit" large table = 32 values. The mask: all bit belonging to the table
- * are 1, the all above 0.
- */
-#define TABLE_BITS  (5)
-#define TABLE_SIZE  (1<<TABLE_BITS)
-#define TABLE_MASK  (TABLE_SIZE-1)
- 
-/*
- * The lookup table is to 90DEG, the input can be -360 to 360 DEG, where negative
- * values are transformed to positive before further processing. We need two
- * additional bits (*4) to represent 360 DEG:
- */
-#define LOOKUP_BITS (TABLE_BITS+2)
-#define LOOKUP_MASK ((1<<LOOKUP_BITS)-1)
-#define FLIP_BIT    (1<<TABLE_BITS)
-#define NEGATE_BIT  (1<<(TABLE_BITS+1))
-#define INTERP_BITS (INT16_BITS-1-LOOKUP_BITS)
-#define INTERP_MASK ((1<<INTERP_BITS)-1)
- 
 /**
- * "5 bit" lookup table for the offsets. These are the sines for exactly
- * at 0deg, 11.25deg, 22.5deg etc. The values are from -1 to 1 in Q15.
+ * @brief      Check the calibration units written by test_waveform_past
  */
-static int16_t sin90[TABLE_SIZE+1] = {
-  0x0000,0x0647,0x0c8b,0x12c7,0x18f8,0x1f19,0x2527,0x2b1e,
-  0x30fb,0x36b9,0x3c56,0x41cd,0x471c,0x4c3f,0x5133,0x55f4,
-  0x5a81,0x5ed6,0x62f1,0x66ce,0x6a6c,0x6dc9,0x70e1,0x73b5,
-  0x7640,0x7883,0x7a7c,0x7c29,0x7d89,0x7e9c,0x7f61,0x7fd7,
-  0x7fff
-};
- 
+static bool calibration_intact(past_t *past)
+{
+    for (uint32_t id = past_A_ADC_K; id <= past_VIN_ADC_C; id++) {
+        const float *p;
+        uint32_t length;
+        if (!past_read_unit(past, id, (const void**) &p, &length) || length != sizeof(float) || *p != id * 1.5f) {
+            printf("  calibration unit %u lost\n", id);
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
- * Sine calculation using interpolated table lookup.
- * Instead of radiants or degrees we use "turns" here. Means this
- * sine does NOT return one phase for 0 to 2*PI, but for 0 to 1.
- * Input: -1 to 1 as int16 Q15  == -32768 to 32767.
- * Output: -1 to 1 as int16 Q15 == -32768 to 32767.
- *
- * See the full description at www.AtWillys.de for the detailed
- * explanation.
- *
- * @param int16_t angle Q15
- * @return int16_t Q15
+ * @brief      Rewrite the largest stored waveform many times in a past
+ *             holding what the firmware keeps there, the calibration and
+ *             settings must survive every rewrite and garbage collection
  */
-static int16_t sin1(int16_t angle)
+static bool test_waveform_past(void)
 {
-  int16_t v0, v1;
-  if(angle < 0) { angle += INT16_MAX; angle += 1; }
-  v0 = (angle >> INTERP_BITS);
-  if(v0 & FLIP_BIT) { v0 = ~v0; v1 = ~angle; } else { v1 = angle; }
-  v0 &= TABLE_MASK;
-  v1 = sin90[v0] + (int16_t) (((int32_t) (sin90[v0+1]-sin90[v0]) * (v1 & INTERP_MASK)) >> INTERP_BITS);
-  if((angle >> INTERP_BITS) & NEGATE_BIT) v1 = -v1;
-  return v1;
-}
+    /** The layout func_gen writes */
+    struct {
+        uint32_t num_points;
+        uint16_t mv[FUNC_GEN_PERSIST_POINTS];
+    } waveform;
+    uint32_t length = sizeof(uint32_t) + ((FUNC_GEN_PERSIST_POINTS * sizeof(uint16_t) + 3) & ~3);
+    /** Git hashes with a -dirty suffix are the longest strings in past */
+    const char *hash = "0123456789abcdef0123456789abcdef01234567";
+    uint32_t value = 1;
+    past_t past;
+
+    memset(past_block1, 0xcd, sizeof(past_block1));
+    memset(past_block2, 0xcd, sizeof(past_block2));
+    past.blocks[0] = (uint32_t) past_block1;
+    past.blocks[1] = (uint32_t) past_block2;
+    if (!past_init(&past)) {
+        return false;
+    }
+    if (!past_write_unit(&past, past_boot_git_hash, (void*) hash, strlen(hash)) ||
+        !past_write_unit(&past, past_app_git_hash, (void*) hash, strlen(hash)) ||
+        !past_write_unit(&past, past_power, &value, sizeof(value)) ||
+        !past_write_unit(&past, past_tft_inversion, &value, sizeof(value)) ||
+        !past_write_unit(&past, past_tft_brightness, &value, sizeof(value)) ||
+        !past_write_unit(&past, past_uart_baud, &value, sizeof(value))) {
+        return false;
+    }
+    for (uint32_t id = past_A_ADC_K; id <= past_VIN_ADC_C; id++) {
+        float k = id * 1.5f;
+        if (!past_write_unit(&past, id, &k, sizeof(k))) {
+            return false;
+        }
+    }
+    /** Voltage and current of the CV, CC and CL screens, the function
+        generator settings and waveform */
+    for (uint32_t screen = 1; screen <= 5; screen++) {
+        for (uint32_t i = 0; i < (screen == 5 ? 3 : 2); i++) {
+            if (!past_write_unit(&past, (screen << 24) | i, &value, sizeof(value))) {
+                return false;
+            }
+        }
+    }
 
+    for (uint32_t pass = 0; pass < 32; pass++) {
+        waveform.num_points = FUNC_GEN_PERSIST_POINTS;
+        for (uint32_t i = 0; i < FUNC_GEN_PERSIST_POINTS; i++) {
+            waveform.mv[i] = pass * 1000 + i;
+        }
+        if (!past_write_unit(&past, (5 << 24) | 3, &waveform, length)) {
+            printf("  waveform write %u failed\n", pass);
+            return false;
+        }
+        const uint32_t *p;
+        uint32_t read_length;
+        if (!past_read_unit(&past, (5 << 24) | 3, (const void**) &p, &read_length) ||
+            read_length != length || memcmp(p, &waveform, length)) {
+            return false;
+        }
+        if (!calibration_intact(&past)) {
+            return false;
+        }
+    }
+    /** A restart finds the same units */
+    return past_init(&past) && calibration_intact(&past);
+}
 
 /**
- * @brief      Compute a sin signal as selected by the user
- *
- * @param[in]  time   the current clock in microsecond 
- * @param[in]  period period of the generated signal in microsecond (frequency in range 0 to 5KHz, period is in range 200 to 1<<31)
- * @param[in]  max    the amplitude of the voltage for this generator
- *
- * @retval     int32_t the voltage to apply
+ * @brief      Dump four cycles of each waveform for plotting
  */
-static int32_t sin_gen(uint32_t time_in_us, uint32_t period_in_us, int32_t max)
+static void write_csv(void)
 {
-    if (!period_in_us) return max;
-    /** The time is ticking at 1000000Hz so a unit is 1us. The production is (max/2) * sin((t%T)/T*2*PI) + (max/2) */
-    uint32_t t = time_in_us % period_in_us;
-    
-    return (max/2) * sin1((int16_t)((t * 32768) / period_in_us)) / 32768 + max/2; // There's a small error in amplitude here to avoid dividing by 32767
+    uint16_t square[DDS_BUFFER_SIZE], saw[DDS_BUFFER_SIZE], sine[DDS_BUFFER_SIZE];
+    FILE *out = fopen("funcgen.csv", "wb");
+    if (!out) {
+        return;
+    }
+    dds_fill(square, dds_square, 20000, 4);
+    dds_fill(saw, dds_saw, 20000, 4);
+    dds_fill(sine, dds_sine, 20000, 4);
+    for (uint32_t i = 0; i < DDS_BUFFER_SIZE; i++) {
+        fprintf(out, "%u;%u;%u;%u\n", i, square[i], saw[i], sine[i]);
+    }
+    fclose(out);
 }
 
-
-int main(int argc, char ** argv)
+int main(int argc, char const *argv[])
 {
-    uint32_t period = 10000/4;
-    FILE * out = fopen("funcgen.csv", "wb");
-    if (!out) return 1;
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_plan_range);
+    RUN_TEST(test_frequency_accuracy);
+    RUN_TEST(test_table_frequency);
+    RUN_TEST(test_range);
+    RUN_TEST(test_sine_thd);
+    RUN_TEST(test_square_saw_thd);
+    RUN_TEST(test_table_points);
+    RUN_TEST(test_table_interpolation);
+    RUN_TEST(test_table_clipping);
+    RUN_TEST(test_upload_order);
+    RUN_TEST(test_waveform_past);
+    write_csv();
 
-    for (uint32_t i = 0; i < 10000; i++)
-    {
-        int32_t q = square_gen(i, period, 20000), a = saw_gen(i, period, 20000), n = sin_gen(i, period, 20000);
-        fprintf(out, "%d;%d;%d;%d\n", i, q, a, n);
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
     }
-    fclose(out);
-    return 0;
-}
\ No newline at end of file
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+Decode every run length encoded gfx-*.c icon the way tft_blit_rle(...) does
+and compare it pixel for pixel with the PNG it was generated from.
+
+Usage: gfx_rle_test.py (run from opendps/tests)
+"""
+
+import glob
+import os
+import re
+import sys
+
+sys.path.insert(0, "..")
+from gen_lookup import Image, image_to_bgr565
+
+RLE_RUN = 0x8000
+RLE_MAX_COUNT = 0x7FFF
+
+"""
+Decode an icon, returns None if the packets do not add up to num_pixels
+"""
+def decode(rle, num_pixels):
+    pixels = []
+    i = 0
+    while len(pixels) < num_pixels:
+        if i >= len(rle):
+            return None
+        count = rle[i] & RLE_MAX_COUNT
+        if count == 0 or len(pixels) + count > num_pixels:
+            return None
+        if rle[i] & RLE_RUN:
+            pixels += [rle[i+1]] * count
+            i += 2
+        else:
+            pixels += rle[i+1:i+1+count]
+            i += 1 + count
+    return pixels if i == len(rle) else None
+
+def test_icon(source_filename):
+    name = source_filename[len("../gfx-"):-len(".c")]
+    source = open(source_filename).read()
+    header = open(source_filename[:-2] + ".h").read()
+
+    png_filename = os.path.join("..", re.search(r"-i (\S+\.png)", source).group(1))
+    width = int(re.search(r"#define GFX_\w+_WIDTH\s+\((\d+)\)", header).group(1))
+    height = int(re.search(r"#define GFX_\w+_HEIGHT\s+\((\d+)\)", header).group(1))
+    rle = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]{4}", source.split("{", 1)[1])]
+
+    image = Image.open(png_filename)
+    if image.size != (width, height):
+        print(f"Error: {name} is {width}x{height} but {png_filename} is {image.size[0]}x{image.size[1]}")
+        return False
+
+    pixels = decode(rle, width * height)
+    if pixels is None:
+        print(f"Error: {name} does not decode to {width}x{height} pixels")
+        return False
+
+    expected = image_to_bgr565(image)
+    for i in range(len(expected)):
+        if pixels[i] != expected[i]:
+            print(f"Error: {name} pixel ({i % width},{i // width}) is {pixels[i]:#06x}, expected {expected[i]:#06x}")
+            return False
+
+    print(f"{name:12s} {width*height*2:5d} -> {len(rle)*2:5d} bytes")
+    return True
+
+def main():
+    num_fail = 0
+    icons = sorted(glob.glob("../gfx-*.c"))
+    for source_filename in icons:
+        if not test_icon(source_filename):
+            num_fail += 1
+
+    if num_fail == 0:
+        print("All tests passed")
+    else:
+        print(f"{num_fail}/{len(icons)} test failed")
+    print("")
+    return 1 if num_fail else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,397 @@
+/*
+ * Host test for the measurement history log
+ *
+ * Runs history.c against a simulated 4 page log area. Records are produced
+ * the way the firmware does, by firing the sample timer with set
+ * measurements, and read back in chunks with history_read(...) like
+ * cmd_history_read does. The words are decoded with the format described in
+ * history.c and compared with the measurements that were logged.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "flash.h"
+#include "swtimer.h"
+#include "history.h"
+
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+#define PAGE_SIZE       (1024)
+#define WORDS_PER_PAGE  (PAGE_SIZE / 4)
+#define NUM_PAGES       (4)
+/** Samples per record, CONFIG_HISTORY_INTERVAL at one sample per second */
+#define SAMPLES_PER_RECORD  (10)
+#define MAX_RECORDS     (4096)
+/** Xored with the sequence number in the page header check word */
+#define PAGE_MAGIC      (0x0d15a7e)
+
+/** The log area needs to live in the same 32 bit address space as history */
+static uint8_t log_area[NUM_PAGES][PAGE_SIZE] __attribute__((aligned(4)));
+static uint32_t g_num_erases;
+
+/** Stubs for the modules history.c uses, raw ADC values are in 10mV */
+static swtimer_t *g_sample_timer;
+static uint64_t g_now;
+static uint16_t g_v_out, g_i_out, g_v_in;
+
+void lock_flash(void) {}
+void unlock_flash(void) {}
+
+void flash_erase_page(uint32_t address)
+{
+    memset((char*) address, 0xff, PAGE_SIZE);
+    g_num_erases++;
+}
+
+void flash_program_word(uint32_t address, uint32_t data)
+{
+    /** Programming can only clear bits */
+    *((uint32_t*) address) &= data;
+}
+
+uint32_t flash_get_status_flags(void)
+{
+    return FLASH_SR_EOP;
+}
+
+void swtimer_start(swtimer_t *timer, uint32_t delay, uint32_t period)
+{
+    (void) delay;
+    (void) period;
+    g_sample_timer = timer;
+}
+
+uint64_t get_ticks(void)
+{
+    return g_now;
+}
+
+void hw_get_adc_values(uint16_t *i_out_raw, uint16_t *v_in_raw, uint16_t *v_out_raw)
+{
+    *i_out_raw = g_i_out;
+    *v_in_raw = g_v_in;
+    *v_out_raw = g_v_out;
+}
+
+bool pwrctl_vout_enabled(void)
+{
+    return true;
+}
+
+uint32_t pwrctl_calc_vin(uint16_t raw)
+{
+    return raw * 10;
+}
+
+uint32_t pwrctl_calc_vout(uint16_t raw)
+{
+    return raw * 10;
+}
+
+uint32_t pwrctl_calc_iout(uint16_t raw)
+{
+    return raw;
+}
+
+typedef struct {
+    uint32_t v_out; /** 10mV */
+    uint32_t i_out; /** mA */
+    uint32_t v_in; /** 10mV */
+} record_t;
+
+/** What was logged and what was decoded */
+static record_t g_logged[MAX_RECORDS];
+static uint32_t g_num_logged;
+static record_t g_decoded[MAX_RECORDS];
+static uint32_t g_num_decoded;
+
+/** Output energy since the first sample, as history.c accumulates it, and
+    the energy in mWh after each record and from the energy word before it */
+#define NO_ENERGY  (0xffffffff)
+static uint64_t g_energy_mj;
+static uint32_t g_logged_energy[MAX_RECORDS];
+static uint32_t g_decoded_energy[MAX_RECORDS];
+
+/**
+ * @brief      Log one record, the measurements are in the units of the log
+ */
+static void log_record(uint32_t v_out, uint32_t i_out, uint32_t v_in)
+{
+    g_v_out = v_out;
+    g_i_out = i_out;
+    g_v_in = v_in;
+    for (uint32_t i = 0; i < SAMPLES_PER_RECORD; i++) {
+        g_now += 1000;
+        g_sample_timer->callback(g_sample_timer);
+        /** mV * mA * 1000 ms */
+        g_energy_mj += (uint64_t) v_out * 10 * i_out * 1000 / 1000000;
+    }
+    /** 1 mWh is 3600 mJ */
+    g_logged_energy[g_num_logged] = (uint32_t) (g_energy_mj / 3600) & 0x0fffffff;
+    g_logged[g_num_logged].v_out = v_out;
+    g_logged[g_num_logged].i_out = i_out;
+    g_logged[g_num_logged].v_in = v_in;
+    g_num_logged++;
+}
+
+static int32_t sign_extend(uint32_t value, uint32_t bits)
+{
+    return (int32_t) (value << (32 - bits)) >> (32 - bits);
+}
+
+/**
+ * @brief      Read the whole log in chunks and decode it
+ *
+ * @return     false if the chunks were not consecutive
+ */
+static bool read_log(void)
+{
+    uint32_t words[HISTORY_CHUNK_WORDS];
+    uint32_t count;
+    uint32_t offset = 0;
+    bool have_absolute = false;
+    record_t cur = {0, 0, 0};
+    uint32_t pending_v_in = 0;
+    uint32_t pending_energy = NO_ENERGY;
+    g_num_decoded = 0;
+    while (offset < history_head()) {
+        uint32_t pos = history_read(offset, words, &count);
+        if (pos < offset || (offset != 0 && pos != offset) || count > HISTORY_CHUNK_WORDS) {
+            printf("  read at %u returned position %u, %u words\n", offset, pos, count);
+            return false;
+        }
+        if (count == 0) {
+            return false;
+        }
+        /** A chunk never crosses a page */
+        if (pos / WORDS_PER_PAGE != (pos + count - 1) / WORDS_PER_PAGE) {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t w = words[i];
+            switch (w >> 28) {
+                case 0xa: /** Time */
+                    have_absolute = false;
+                    break;
+                case 0xb: /** Page header, sequence number and check word */
+                    if ((pos + i) % WORDS_PER_PAGE > 1 ||
+                        (w & 0x0fffffff) != (((pos + i) / WORDS_PER_PAGE) ^ ((pos + i) % WORDS_PER_PAGE ? PAGE_MAGIC : 0))) {
+                        printf("  bad page header %08x at %u\n", w, pos + i);
+                        return false;
+                    }
+                    break;
+                case 0xc: /** Absolute sample */
+                    cur.v_out = (w >> 15) & 0x1fff;
+                    cur.i_out = w & 0x7fff;
+                    cur.v_in = pending_v_in;
+                    have_absolute = true;
+                    g_decoded_energy[g_num_decoded] = pending_energy;
+                    pending_energy = NO_ENERGY;
+                    g_decoded[g_num_decoded++] = cur;
+                    break;
+                case 0xd: /** V_in */
+                    pending_v_in = w & 0x1fff;
+                    break;
+                case 0xe: /** Energy of the next sample */
+                    pending_energy = w & 0x0fffffff;
+                    break;
+                case 0xf: /** Erased or torn */
+                    break;
+                default: /** Delta sample */
+                    if (have_absolute) {
+                        cur.v_out += sign_extend(w >> 20, 11);
+                        cur.i_out += sign_extend(w >> 9, 11);
+                        cur.v_in += sign_extend(w, 9);
+                        g_decoded_energy[g_num_decoded] = pending_energy;
+                        pending_energy = NO_ENERGY;
+                        g_decoded[g_num_decoded++] = cur;
+                    }
+                    break;
+            }
+        }
+        offset = pos + count;
+    }
+    return true;
+}
+
+/**
+ * @brief      Check the decoded records are the last logged ones and carry
+ *             the logged energy, every keyframe has an energy word
+ */
+static bool decoded_matches(void)
+{
+    uint32_t num_energy = 0;
+    if (g_num_decoded == 0 || g_num_decoded > g_num_logged) {
+        printf("  decoded %u of %u records\n", g_num_decoded, g_num_logged);
+        return false;
+    }
+    const record_t *logged = &g_logged[g_num_logged - g_num_decoded];
+    const uint32_t *logged_energy = &g_logged_energy[g_num_logged - g_num_decoded];
+    for (uint32_t i = 0; i < g_num_decoded; i++) {
+        if (g_decoded_energy[i] != NO_ENERGY) {
+            if (g_decoded_energy[i] != logged_energy[i]) {
+                printf("  record %u has energy %u mWh, logged %u mWh\n", i, g_decoded_energy[i], logged_energy[i]);
+                return false;
+            }
+            num_energy++;
+        }
+        if (memcmp(&logged[i], &g_decoded[i], sizeof(record_t))) {
+            printf("  record %u is %u/%u/%u, logged %u/%u/%u\n", i,
+                   g_decoded[i].v_out, g_decoded[i].i_out, g_decoded[i].v_in,
+                   logged[i].v_out, logged[i].i_out, logged[i].v_in);
+            return false;
+        }
+    }
+    return num_energy > 0;
+}
+
+/**
+ * @brief      Start with a blank or garbage filled log area
+ */
+static void reset(uint8_t fill)
+{
+    memset(log_area, fill, sizeof(log_area));
+    g_num_logged = 0;
+    g_num_erases = 0;
+    history_init((uint32_t) log_area, NUM_PAGES);
+}
+
+static bool test_format(void)
+{
+    reset(0xff);
+    if (history_head() != 2 || history_interval() != SAMPLES_PER_RECORD || !g_sample_timer) {
+        return false;
+    }
+    reset(0x00);
+    /** A zeroed area holds no valid page header and is formatted */
+    if (history_head() != 2 || *(uint32_t*) log_area[0] != 0xb0000000 || g_num_erases != 1) {
+        return false;
+    }
+    /** Leftover code starting with a Thumb push (0xb5xx) is no page header */
+    memset(log_area, 0x00, sizeof(log_area));
+    for (uint32_t i = 0; i < NUM_PAGES; i++) {
+        *(uint32_t*) log_area[i] = 0xb5f04607 + i;
+        *(uint32_t*) (log_area[i] + 4) = 0xb0854606;
+    }
+    g_num_erases = 0;
+    history_init((uint32_t) log_area, NUM_PAGES);
+    return history_head() == 2 && *(uint32_t*) log_area[0] == 0xb0000000 && g_num_erases == 1;
+}
+
+static bool test_record_packing(void)
+{
+    reset(0xff);
+    /** The first record is a keyframe: time, V_in, energy and absolute sample */
+    log_record(500, 100, 1200);
+    if (history_head() != 6) {
+        return false;
+    }
+    /** Small changes are a single delta word each, large ones a keyframe */
+    log_record(510, 90, 1201);
+    log_record(510 + 1023, 90 + 1023, 1201 - 255);
+    if (history_head() != 8) {
+        return false;
+    }
+    log_record(8000, 90, 1201);
+    if (history_head() != 11) {
+        return false;
+    }
+    /** Zero, field extremes and the largest absolute values */
+    log_record(0, 0, 0);
+    log_record(8191, 32767, 8191);
+    log_record(8191 - 1023, 32767 - 1023, 8191 - 255);
+    return read_log() && g_num_decoded == g_num_logged && decoded_matches();
+}
+
+static bool test_wraparound(void)
+{
+    reset(0xff);
+    for (uint32_t i = 0; i < 4000; i++) {
+        log_record(1000 + (i % 7) * 13, 200 + (i % 5) * 100, 1500 - (i % 3));
+    }
+    /** The log wrapped several times, reading from 0 starts at the oldest page */
+    uint32_t words[HISTORY_CHUNK_WORDS];
+    uint32_t count;
+    uint32_t head = history_head();
+    uint32_t oldest = (head / WORDS_PER_PAGE - (NUM_PAGES - 1)) * WORDS_PER_PAGE;
+    if (head < 3 * NUM_PAGES * WORDS_PER_PAGE || history_read(0, words, &count) != oldest || count == 0) {
+        return false;
+    }
+    /** Each page change erased the page it reused */
+    if (g_num_erases != head / WORDS_PER_PAGE + 1) {
+        return false;
+    }
+    if (!read_log() || !decoded_matches()) {
+        return false;
+    }
+    /** Everything in the three full pages and the current one is kept */
+    return g_num_decoded > 3 * (WORDS_PER_PAGE - 32);
+}
+
+static bool test_reboot(void)
+{
+    reset(0xff);
+    for (uint32_t i = 0; i < 600; i++) {
+        log_record(1000 + i % 11, 300, 1500);
+    }
+    uint32_t head = history_head();
+    /** A reboot continues after the last word and starts a new session */
+    history_init((uint32_t) log_area, NUM_PAGES);
+    if (history_head() != head) {
+        return false;
+    }
+    log_record(2000, 400, 1600);
+    if (history_head() != head + 4) {
+        return false;
+    }
+    /** A word torn by a power loss is skipped, the next record starts after it */
+    head = history_head();
+    *(uint32_t*) (log_area[(head / WORDS_PER_PAGE) % NUM_PAGES] + 4 * (head % WORDS_PER_PAGE)) = 0xfffffff0;
+    history_init((uint32_t) log_area, NUM_PAGES);
+    if (history_head() != head + 1) {
+        return false;
+    }
+    log_record(2100, 400, 1600);
+    return read_log() && decoded_matches();
+}
+
+static bool test_read_beyond_head(void)
+{
+    uint32_t words[HISTORY_CHUNK_WORDS];
+    uint32_t count;
+    reset(0xff);
+    log_record(500, 100, 1200);
+    uint32_t head = history_head();
+    return history_read(head, words, &count) == head && count == 0 &&
+           history_read(head + 1000, words, &count) == head && count == 0;
+}
+
+int main(int argc, char const *argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_format);
+    RUN_TEST(test_record_packing);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_reboot);
+    RUN_TEST(test_read_beyond_head);
+
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
@@ -0,0 +1,331 @@
+/*
+ * Power-fail injection test for past
+ *
+ * Replays random sequences of unit writes, rewrites, erases and reboots
+ * against a simulated pair of flash blocks. For every operation in every
+ * sequence the operation is re-run once for each flash event it causes and
+ * "power" is cut at that event. After each cut past_init(...) is run on a
+ * fresh past_t and the contents are verified against a model of what has been
+ * committed. The unit being written when power was lost may hold either its
+ * old or its new value, every other unit must be intact. A few more operations
+ * are then run on the recovered past to make sure recovery left it in a sane
+ * state.
+ *
+ * Flash is simulated the way the STM32F100 behaves:
+ *  - programming can only clear bits
+ *  - a word is programmed as two half words, lower half first, so a cut may
+ *    leave a torn word with only the lower half written
+ *  - page erase is treated as atomic (the cut happens before the erase)
+ *
+ * Usage: past_powerfail_test [num_sequences] [seed]
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <time.h>
+#include "past.h"
+#include "flash.h"
+
+#define BLOCK_SIZE      (1024)
+#define NUM_IDS         (8)
+#define MAX_UNIT_SIZE   (48)
+#define OPS_PER_SEQ     (64)
+#define POST_CUT_OPS    (4)
+
+typedef enum {
+    op_write = 0,
+    op_erase,
+    op_reboot,
+    op_last
+} op_type_t;
+
+typedef struct {
+    op_type_t type;
+    past_id_t id;
+    uint32_t length;
+    uint8_t data[MAX_UNIT_SIZE];
+} op_t;
+
+typedef struct {
+    bool present;
+    uint32_t length;
+    uint8_t data[MAX_UNIT_SIZE];
+} unit_model_t;
+
+typedef struct {
+    uint8_t flash[2][BLOCK_SIZE];
+    past_t past;
+    unit_model_t model[NUM_IDS + 1];
+} snapshot_t;
+
+/** The two past blocks need to live in the same 32 bit address space as past */
+static uint8_t past_blocks[2][BLOCK_SIZE] __attribute__((aligned(4)));
+
+static past_t past;
+static unit_model_t model[NUM_IDS + 1];
+
+/** Flash event counter and the event at which power is lost (-1 for never) */
+static int32_t g_flash_events;
+static int32_t g_cut_at = -1;
+static jmp_buf g_power_cut;
+
+static uint32_t g_num_fail, g_num_pass;
+static uint32_t g_num_ops, g_num_cuts;
+static uint32_t g_rand_state;
+
+void lock_flash(void) {}
+void unlock_flash(void) {}
+
+/**
+  * @brief Count a flash event and lose power if it is the selected one
+  */
+static void flash_event(void)
+{
+    if (g_flash_events++ == g_cut_at) {
+        longjmp(g_power_cut, 1);
+    }
+}
+
+void flash_erase_page(uint32_t address)
+{
+    flash_event();
+    memset((char*) address, 0xff, BLOCK_SIZE);
+}
+
+void flash_program_word(uint32_t address, uint32_t data)
+{
+    volatile uint16_t *p = (uint16_t*) address;
+    flash_event();
+    p[0] &= (uint16_t) data;
+    flash_event();
+    p[1] &= (uint16_t) (data >> 16);
+}
+
+uint32_t flash_get_status_flags(void)
+{
+    return FLASH_SR_EOP;
+}
+
+static uint32_t rand32(void)
+{
+    /** xorshift32 */
+    g_rand_state ^= g_rand_state << 13;
+    g_rand_state ^= g_rand_state >> 17;
+    g_rand_state ^= g_rand_state << 5;
+    return g_rand_state;
+}
+
+static void random_op(op_t *op)
+{
+    uint32_t r = rand32() % 16;
+    memset(op, 0, sizeof(*op));
+    if (r < 11) {
+        op->type = op_write;
+    } else if (r < 14) {
+        op->type = op_erase;
+    } else {
+        op->type = op_reboot;
+    }
+    op->id = 1 + rand32() % NUM_IDS;
+    op->length = 4 + rand32() % (MAX_UNIT_SIZE - 3);
+    for (uint32_t i = 0; i < op->length; i++) {
+        op->data[i] = rand32();
+    }
+}
+
+static void past_reboot(void)
+{
+    memset(&past, 0, sizeof(past));
+    past.blocks[0] = (uint32_t) past_blocks[0];
+    past.blocks[1] = (uint32_t) past_blocks[1];
+    if (!past_init(&past)) {
+        printf("Error: past_init failed\n");
+        g_num_fail++;
+    }
+}
+
+/**
+  * @brief Run an operation against past and, if it succeeds, the model
+  * @retval false if past reported failure for an operation expected to succeed
+  */
+static bool run_op(op_t *op)
+{
+    bool success = true;
+    switch (op->type) {
+        case op_write:
+            success = past_write_unit(&past, op->id, op->data, op->length);
+            if (success) {
+                model[op->id].present = true;
+                model[op->id].length = op->length;
+                memcpy(model[op->id].data, op->data, op->length);
+            }
+            break;
+        case op_erase:
+            /** Erasing a missing unit is expected to fail */
+            if (past_erase_unit(&past, op->id) != model[op->id].present) {
+                success = false;
+            }
+            model[op->id].present = false;
+            break;
+        case op_reboot:
+            past_reboot();
+            break;
+        default:
+            break;
+    }
+    g_num_ops++;
+    return success;
+}
+
+static bool unit_matches(past_id_t id, unit_model_t *m)
+{
+    const void *data;
+    uint32_t length;
+    bool found = past_read_unit(&past, id, &data, &length);
+    if (!m->present) {
+        return !found;
+    }
+    return found && length == m->length && memcmp(data, m->data, length) == 0;
+}
+
+/**
+  * @brief Verify past contents against the model
+  * @param in_flight the operation interrupted by a power cut or NULL
+  * @retval true if past contents are consistent
+  */
+static bool verify(op_t *in_flight)
+{
+    bool success = true;
+    for (past_id_t id = 1; id <= NUM_IDS; id++) {
+        if (in_flight && in_flight->id == id && in_flight->type != op_reboot) {
+            unit_model_t after;
+            after.present = in_flight->type == op_write;
+            after.length = in_flight->length;
+            memcpy(after.data, in_flight->data, in_flight->length);
+            if (unit_matches(id, &model[id])) {
+                continue;
+            } else if (unit_matches(id, &after)) {
+                /** The interrupted operation made it, update the model */
+                model[id] = after;
+                continue;
+            }
+        } else if (unit_matches(id, &model[id])) {
+            continue;
+        }
+        printf("Error: unit %u lost or corrupted\n", id);
+        success = false;
+    }
+    return success;
+}
+
+/**
+  * @brief Cut power at every flash event of an operation and check recovery
+  * @param op the operation to interrupt
+  * @param snap snapshot of flash, past and the model before the operation
+  * @param seq sequence number (for error reports)
+  * @retval false if any recovery failed
+  */
+static bool inject_power_cuts(op_t *op, snapshot_t *snap, uint32_t seq)
+{
+    for (int32_t cut = 0; ; cut++) {
+        memcpy(past_blocks, snap->flash, sizeof(past_blocks));
+        past = snap->past;
+        memcpy(model, snap->model, sizeof(model));
+        g_flash_events = 0;
+        g_cut_at = cut;
+        if (setjmp(g_power_cut) == 0) {
+            (void) run_op(op);
+            g_cut_at = -1;
+            /** The operation completed before reaching the cut */
+            return true;
+        }
+        g_cut_at = -1;
+        g_num_cuts++;
+
+        /** Power may also be lost while recovering */
+        g_flash_events = 0;
+        g_cut_at = rand32() % 64;
+        if (setjmp(g_power_cut) == 0) {
+            past_reboot();
+        } else {
+            g_num_cuts++;
+        }
+        g_cut_at = -1;
+        past_reboot();
+        bool success = verify(op);
+        /** Exercise the recovered past and reboot once more */
+        for (uint32_t i = 0; i < POST_CUT_OPS && success; i++) {
+            op_t post;
+            random_op(&post);
+            success = run_op(&post) && verify(NULL);
+        }
+        if (success) {
+            past_reboot();
+            success = verify(NULL);
+        }
+        if (success) {
+            g_num_pass++;
+        } else {
+            printf("Error: sequence %u, op %u (id %u) failed after cut at flash event %d\n", seq, op->type, op->id, cut);
+            g_num_fail++;
+            return false;
+        }
+    }
+}
+
+int main(int argc, char const *argv[])
+{
+    uint32_t num_sequences = argc > 1 ? strtoul(argv[1], NULL, 0) : 500;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : 0x13042018;
+    static snapshot_t snap;
+    clock_t start = clock();
+
+    for (uint32_t seq = 0; seq < num_sequences; seq++) {
+        g_rand_state = seed + seq * 0x9e3779b9;
+        if (!g_rand_state) {
+            g_rand_state = 1;
+        }
+        memset(past_blocks, 0xff, sizeof(past_blocks));
+        memset(model, 0, sizeof(model));
+        past_reboot();
+        for (uint32_t i = 0; i < OPS_PER_SEQ; i++) {
+            op_t op;
+            random_op(&op);
+            memcpy(snap.flash, past_blocks, sizeof(past_blocks));
+            snap.past = past;
+            memcpy(snap.model, model, sizeof(model));
+            uint32_t rand_state = g_rand_state;
+            if (!inject_power_cuts(&op, &snap, seq)) {
+                break;
+            }
+            /** Now run the operation to completion from the same state */
+            memcpy(past_blocks, snap.flash, sizeof(past_blocks));
+            past = snap.past;
+            memcpy(model, snap.model, sizeof(model));
+            g_rand_state = rand_state;
+            if (run_op(&op) && verify(NULL)) {
+                g_num_pass++;
+            } else {
+                printf("Error: sequence %u, op %u (id %u) failed without power cut\n", seq, op.type, op.id);
+                g_num_fail++;
+                break;
+            }
+        }
+    }
+
+    double elapsed = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%u sequences, %u operations, %u power cuts in %.2f s (%.0f ops/s)\n",
+           num_sequences, g_num_ops, g_num_cuts, elapsed, elapsed > 0 ? g_num_ops / elapsed : 0);
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass + g_num_fail);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
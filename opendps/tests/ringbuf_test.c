@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "ringbuf.h"
+
+/** Words passed from the producer to the consumer thread in each test */
+#define NUM_WORDS  (4000000)
+
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+static ringbuf_t g_ring;
+static uint8_t g_buffer[2*64];
+static uint32_t g_bulk_size;
+static bool g_order_ok;
+
+static bool test_size(void)
+{
+    ringbuf_t ring;
+    uint8_t buffer[2*48];
+    ringbuf_init(&ring, buffer, sizeof(buffer));
+    uint32_t count = 0;
+    while (ringbuf_put(&ring, count)) {
+        count++;
+    }
+    /** 48 words round down to 32, all of them are used */
+    return count == 32;
+}
+
+static bool test_fifo(void)
+{
+    ringbuf_t ring;
+    uint8_t buffer[2*8];
+    uint16_t word;
+    ringbuf_init(&ring, buffer, sizeof(buffer));
+    if (!ringbuf_empty(&ring) || ringbuf_get(&ring, &word)) {
+        return false;
+    }
+    for (uint16_t round = 0; round < 100; round++) {
+        for (uint16_t i = 0; i < 5; i++) {
+            if (!ringbuf_put(&ring, round * 5 + i)) {
+                return false;
+            }
+        }
+        for (uint16_t i = 0; i < 5; i++) {
+            if (!ringbuf_get(&ring, &word) || word != round * 5 + i) {
+                return false;
+            }
+        }
+    }
+    return ringbuf_empty(&ring);
+}
+
+static bool test_bulk(void)
+{
+    ringbuf_t ring;
+    uint8_t buffer[2*8];
+    uint16_t in[12], out[12];
+    ringbuf_init(&ring, buffer, sizeof(buffer));
+    for (uint16_t i = 0; i < 12; i++) {
+        in[i] = 0x1000 + i;
+    }
+    /** Only 8 fit, then the first 5 are read and 5 more fit */
+    if (ringbuf_put_bulk(&ring, in, 12) != 8 || ringbuf_put_bulk(&ring, in, 1) != 0) {
+        return false;
+    }
+    if (ringbuf_get_bulk(&ring, out, 5) != 5 || ringbuf_put_bulk(&ring, &in[8], 4) != 4) {
+        return false;
+    }
+    if (ringbuf_get_bulk(&ring, &out[5], 12) != 7 || ringbuf_get_bulk(&ring, out, 1) != 0) {
+        return false;
+    }
+    for (uint16_t i = 0; i < 12; i++) {
+        if (out[i] != in[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_index_wrap(void)
+{
+    ringbuf_t ring;
+    uint8_t buffer[2*4];
+    uint16_t word;
+    ringbuf_init(&ring, buffer, sizeof(buffer));
+    /** The free running indices wrap at 2^32 */
+    atomic_store(&ring.write, UINT32_MAX - 5);
+    atomic_store(&ring.read, UINT32_MAX - 5);
+    for (uint16_t i = 0; i < 20; i++) {
+        if (!ringbuf_put(&ring, i) || !ringbuf_put(&ring, i + 100)) {
+            return false;
+        }
+        if (!ringbuf_get(&ring, &word) || word != i || !ringbuf_get(&ring, &word) || word != i + 100) {
+            return false;
+        }
+    }
+    return ringbuf_empty(&ring);
+}
+
+static void *producer(void *arg)
+{
+    (void) arg;
+    uint16_t words[64];
+    uint32_t sent = 0;
+    while (sent < NUM_WORDS) {
+        uint32_t count = NUM_WORDS - sent < g_bulk_size ? NUM_WORDS - sent : g_bulk_size;
+        for (uint32_t i = 0; i < count; i++) {
+            words[i] = (uint16_t) (sent + i);
+        }
+        if (count == 1) {
+            count = ringbuf_put(&g_ring, words[0]) ? 1 : 0;
+        } else {
+            count = ringbuf_put_bulk(&g_ring, words, count);
+        }
+        if (!count) {
+            /** Let the consumer run on a single core host */
+            sched_yield();
+        }
+        sent += count;
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    (void) arg;
+    uint16_t words[64];
+    uint32_t received = 0;
+    g_order_ok = true;
+    while (received < NUM_WORDS) {
+        uint32_t count;
+        if (g_bulk_size == 1) {
+            count = ringbuf_get(&g_ring, words) ? 1 : 0;
+        } else {
+            count = ringbuf_get_bulk(&g_ring, words, g_bulk_size);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            if (words[i] != (uint16_t) (received + i)) {
+                g_order_ok = false;
+            }
+        }
+        if (!count) {
+            sched_yield();
+        }
+        received += count;
+    }
+    return NULL;
+}
+
+/**
+  * @brief Pass NUM_WORDS words between two threads and check their order
+  * @param bulk_size number of words per put and get
+  * @param words_per_second (out) throughput
+  * @retval true if all words arrived in order
+  */
+static bool stress(uint32_t bulk_size, double *words_per_second)
+{
+    pthread_t producer_thread, consumer_thread;
+    struct timespec start, end;
+    ringbuf_init(&g_ring, g_buffer, sizeof(g_buffer));
+    g_bulk_size = bulk_size;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&consumer_thread, NULL, consumer, NULL);
+    pthread_create(&producer_thread, NULL, producer, NULL);
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    *words_per_second = NUM_WORDS / elapsed;
+    return g_order_ok && ringbuf_empty(&g_ring);
+}
+
+static bool test_threads_single(void)
+{
+    double rate;
+    bool ok = stress(1, &rate);
+    printf("  single word: %.1f Mwords/s\n", rate / 1e6);
+    return ok;
+}
+
+static bool test_threads_bulk(void)
+{
+    double rate;
+    bool ok = stress(16, &rate);
+    printf("  16 word bulk: %.1f Mwords/s\n", rate / 1e6);
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_size);
+    RUN_TEST(test_fifo);
+    RUN_TEST(test_bulk);
+    RUN_TEST(test_index_wrap);
+    RUN_TEST(test_threads_single);
+    RUN_TEST(test_threads_bulk);
+
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "uframe.h"
+#include "event.h"
+#include "rxframe.h"
+
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+/** Events posted by the frame pool */
+static uint8_t g_posted[8];
+static uint32_t g_num_posted;
+static bool g_queue_full;
+
+bool event_put(event_t event, uint8_t data)
+{
+    if (event != event_frame_ready || g_queue_full || g_num_posted == sizeof(g_posted)) {
+        return false;
+    }
+    g_posted[g_num_posted++] = data;
+    return true;
+}
+
+static void feed(const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        rxframe_put_char(data[i]);
+    }
+}
+
+/** Handle and release the posted frames like the main loop */
+static void release_all(void)
+{
+    for (uint32_t i = 0; i < g_num_posted; i++) {
+        rxframe_release(g_posted[i]);
+    }
+    g_num_posted = 0;
+}
+
+static bool test_single_frame(void)
+{
+    const uint8_t frame[] = { _SOF, 1, 2, 3, _EOF };
+    const uint8_t noise[] = { 0x55, 0x66 };
+    uint32_t length;
+    feed(noise, sizeof(noise));
+    feed(frame, sizeof(frame));
+    if (g_num_posted != 1) {
+        return false;
+    }
+    uint8_t *data = rxframe_get(g_posted[0], &length);
+    bool ok = data && length == sizeof(frame) && memcmp(data, frame, length) == 0;
+    release_all();
+    return ok;
+}
+
+static bool test_restart(void)
+{
+    /** An unfinished frame is abandoned by the next _SOF */
+    const uint8_t frames[] = { _SOF, 1, 2, _SOF, 3, _EOF };
+    uint32_t length;
+    feed(frames, sizeof(frames));
+    if (g_num_posted != 1) {
+        return false;
+    }
+    uint8_t *data = rxframe_get(g_posted[0], &length);
+    bool ok = data && length == 3 && data[0] == _SOF && data[1] == 3;
+    release_all();
+    return ok;
+}
+
+static bool test_pool_exhausted(void)
+{
+    const uint8_t frame[] = { _SOF, 1, _EOF };
+    for (uint32_t i = 0; i < RXFRAME_NUM_BUFFERS + 1; i++) {
+        feed(frame, sizeof(frame));
+    }
+    /** The frame arriving while all buffers are in use is dropped */
+    if (g_num_posted != RXFRAME_NUM_BUFFERS) {
+        return false;
+    }
+    release_all();
+    feed(frame, sizeof(frame));
+    bool ok = g_num_posted == 1;
+    release_all();
+    return ok;
+}
+
+static bool test_too_long(void)
+{
+    uint32_t length;
+    rxframe_put_char(_SOF);
+    for (uint32_t i = 0; i < MAX_FRAME_LENGTH; i++) {
+        rxframe_put_char(1);
+    }
+    rxframe_put_char(_EOF);
+    if (g_num_posted != 0) {
+        return false;
+    }
+    /** The buffer of the dropped frame is free again */
+    const uint8_t frame[] = { _SOF, 1, _EOF };
+    for (uint32_t i = 0; i < RXFRAME_NUM_BUFFERS; i++) {
+        feed(frame, sizeof(frame));
+    }
+    bool ok = g_num_posted == RXFRAME_NUM_BUFFERS && rxframe_get(g_posted[0], &length) != NULL;
+    release_all();
+    return ok;
+}
+
+static bool test_queue_full(void)
+{
+    const uint8_t frame[] = { _SOF, 1, _EOF };
+    g_queue_full = true;
+    feed(frame, sizeof(frame));
+    g_queue_full = false;
+    /** The buffer of a frame that could not be posted is not lost */
+    for (uint32_t i = 0; i < RXFRAME_NUM_BUFFERS; i++) {
+        feed(frame, sizeof(frame));
+    }
+    bool ok = g_num_posted == RXFRAME_NUM_BUFFERS;
+    release_all();
+    return ok;
+}
+
+static bool test_bad_index(void)
+{
+    uint32_t length;
+    return rxframe_get(RXFRAME_NUM_BUFFERS, &length) == NULL && rxframe_get(0, &length) == NULL;
+}
+
+int main(int argc, char const *argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_single_frame);
+    RUN_TEST(test_restart);
+    RUN_TEST(test_pool_exhausted);
+    RUN_TEST(test_too_long);
+    RUN_TEST(test_queue_full);
+    RUN_TEST(test_bad_index);
+
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "sequence.h"
+
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+/** Time the program is started at, not 0 to catch absolute time mix ups */
+#define START  (1000)
+
+static bool write(const sequence_step_t *steps, uint32_t num_steps, uint32_t passes)
+{
+    sequence_stop();
+    return sequence_write(num_steps, 0, steps, num_steps, passes);
+}
+
+/**
+ * @brief      Run the program from START to its end, following the update
+ *             times it asks for. Records the step each ms is in.
+ *
+ * @return     End time of the program, 0 if it did not end within max_ms
+ */
+static uint64_t run(uint32_t *trace, uint32_t max_ms)
+{
+    uint32_t mv, ma, step, pass;
+    uint64_t now = START;
+    if (!sequence_start(now)) {
+        return 0;
+    }
+    while (now < START + max_ms) {
+        uint64_t next = sequence_update(now, &mv, &ma);
+        if (next == SEQUENCE_END) {
+            return now;
+        }
+        if (next <= now) {
+            return 0;
+        }
+        (void) sequence_progress(&step, &pass);
+        for (; now < next && now < START + max_ms; now++) {
+            trace[now - START] = step;
+        }
+    }
+    return 0;
+}
+
+static bool test_write_validation(void)
+{
+    sequence_step_t steps[2] = {
+        { .duration = 10, .mv = 1000, .ma = 100 },
+        { .duration = 10, .mv = 2000, .ma = 100 },
+    };
+    sequence_step_t zero = { .duration = 0 };
+    sequence_step_t forward = { .duration = 10, .loop_count = 1, .loop_to = 1 };
+    if (sequence_write(0, 0, steps, 0, 1) ||
+        sequence_write(SEQUENCE_MAX_STEPS + 1, 0, steps, 1, 1) ||
+        sequence_write(2, 1, steps, 2, 1) ||
+        sequence_write(1, 0, &zero, 1, 1) ||
+        sequence_write(1, 0, &forward, 1, 1) ||
+        sequence_write(1, 0, steps, 1, SEQUENCE_MAX_PASSES + 1)) {
+        return false;
+    }
+    /** Not complete until the last step has been written */
+    if (!sequence_write(2, 0, steps, 1, 3) || sequence_num_steps() != 0 || sequence_start(START)) {
+        return false;
+    }
+    if (!sequence_write(2, 1, &steps[1], 1, 3) || sequence_num_steps() != 2 || sequence_passes() != 3) {
+        return false;
+    }
+    /** No writes while running */
+    if (!sequence_start(START) || sequence_write(2, 0, steps, 2, 1)) {
+        return false;
+    }
+    sequence_stop();
+    return sequence_write(2, 0, steps, 2, 1);
+}
+
+static bool test_write_order(void)
+{
+    sequence_step_t steps[3] = {
+        { .duration = 10, .mv = 1000, .ma = 100 },
+        { .duration = 10, .mv = 2000, .ma = 100 },
+        { .duration = 10, .mv = 3000, .ma = 100 },
+    };
+    if (!sequence_write(1, 0, steps, 1, 1) || sequence_num_steps() != 1) {
+        return false;
+    }
+    /** A chunk without a preceding index 0 chunk leaves the program alone */
+    if (sequence_write(3, 1, &steps[1], 2, 1) || sequence_num_steps() != 1) {
+        return false;
+    }
+    /** Skipped, repeated and resized chunks are refused */
+    if (!sequence_write(3, 0, steps, 1, 1) ||
+        sequence_write(3, 2, &steps[2], 1, 1) ||
+        !sequence_write(3, 1, &steps[1], 1, 1) ||
+        sequence_write(3, 1, &steps[1], 1, 1) ||
+        sequence_write(2, 2, &steps[2], 1, 1) ||
+        sequence_num_steps() != 0) {
+        return false;
+    }
+    if (!sequence_write(3, 2, &steps[2], 1, 1) || sequence_num_steps() != 3) {
+        return false;
+    }
+    /** The complete program does not take more chunks */
+    return !sequence_write(3, 2, &steps[2], 1, 1) && sequence_num_steps() == 3;
+}
+
+static bool test_timing(void)
+{
+    static uint32_t trace[100];
+    sequence_step_t steps[3] = {
+        { .duration = 5, .mv = 1000, .ma = 100 },
+        { .duration = 7, .mv = 2000, .ma = 200 },
+        { .duration = 3, .mv = 3000, .ma = 300 },
+    };
+    if (!write(steps, 3, 2) || run(trace, 100) != START + 30) {
+        return false;
+    }
+    for (uint32_t t = 0; t < 30; t++) {
+        uint32_t in_pass = t % 15;
+        uint32_t expected = in_pass < 5 ? 1 : in_pass < 12 ? 2 : 3;
+        if (trace[t] != expected) {
+            printf("  %u ms: step %u, expected %u\n", t, trace[t], expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_late_update(void)
+{
+    /** A late update skips the steps that have passed, keeping the timing */
+    uint32_t mv, ma, step, pass;
+    sequence_step_t steps[3] = {
+        { .duration = 5, .mv = 1000, .ma = 100 },
+        { .duration = 5, .mv = 2000, .ma = 200 },
+        { .duration = 5, .mv = 3000, .ma = 300 },
+    };
+    if (!write(steps, 3, 0) || !sequence_start(START)) {
+        return false;
+    }
+    uint64_t next = sequence_update(START + 37, &mv, &ma);
+    (void) sequence_progress(&step, &pass);
+    return next == START + 40 && step == 2 && pass == 3 && mv == 2000 && ma == 200;
+}
+
+static bool test_ramp(void)
+{
+    uint32_t mv, ma;
+    sequence_step_t steps[2] = {
+        { .duration = 100, .mv = 1000, .ma = 500 },
+        { .duration = 100, .mv = 3000, .ma = 100, .ramp = true },
+    };
+    if (!write(steps, 2, 1) || !sequence_start(START)) {
+        return false;
+    }
+    if (sequence_update(START, &mv, &ma) != START + 100 || mv != 1000 || ma != 500) {
+        return false;
+    }
+    uint64_t next = sequence_update(START + 125, &mv, &ma);
+    if (next != START + 125 + SEQUENCE_RAMP_INTERVAL || mv != 1500 || ma != 400) {
+        printf("  %u mV %u mA, next %u\n", mv, ma, (uint32_t) (next - START));
+        return false;
+    }
+    /** The last ramp update is at the end of the step */
+    next = sequence_update(START + 195, &mv, &ma);
+    return next == START + 200 && sequence_update(START + 200, &mv, &ma) == SEQUENCE_END;
+}
+
+static bool test_first_ramp(void)
+{
+    uint32_t mv, ma;
+    sequence_step_t step = { .duration = 100, .mv = 2000, .ma = 1000, .ramp = true };
+    if (!write(&step, 1, 1) || !sequence_start(START)) {
+        return false;
+    }
+    (void) sequence_update(START + 50, &mv, &ma);
+    return mv == 1000 && ma == 500;
+}
+
+static bool test_nested_loops(void)
+{
+    /** 1 (2 3 x2) x3 4, inner loop of steps 2-3 run twice in an outer loop
+        of steps 1-3 run three times */
+    static uint32_t trace[100];
+    sequence_step_t steps[4] = {
+        { .duration = 1, .mv = 1000 },
+        { .duration = 1, .mv = 2000 },
+        { .duration = 1, .mv = 3000, .loop_to = 1, .loop_count = 1 },
+        { .duration = 1, .mv = 4000, .loop_to = 0, .loop_count = 2 },
+    };
+    const uint32_t expected[] = { 1, 2, 3, 2, 3, 4, 1, 2, 3, 2, 3, 4, 1, 2, 3, 2, 3, 4 };
+    uint32_t length = sizeof(expected) / sizeof(expected[0]);
+    if (!write(steps, 4, 1) || run(trace, 100) != START + length) {
+        return false;
+    }
+    return memcmp(trace, expected, sizeof(expected)) == 0;
+}
+
+static bool test_endless(void)
+{
+    static uint32_t trace[1000];
+    sequence_step_t step = { .duration = 3, .mv = 1000 };
+    uint32_t s, pass;
+    if (!write(&step, 1, 0) || run(trace, 1000) != 0) {
+        return false;
+    }
+    /** Still running after 1000 ms */
+    return sequence_progress(&s, &pass) && s == 1 && pass == 334;
+}
+
+int main(int argc, char const *argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_write_validation);
+    RUN_TEST(test_write_order);
+    RUN_TEST(test_timing);
+    RUN_TEST(test_late_update);
+    RUN_TEST(test_ramp);
+    RUN_TEST(test_first_ramp);
+    RUN_TEST(test_nested_loops);
+    RUN_TEST(test_endless);
+
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
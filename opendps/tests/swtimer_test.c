@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "swtimer.h"
+
+#define RUN_TEST(f) \
+    f() ? (printf(" " #f " pass\n"), g_num_pass++) : (printf(" " #f " failed\n"), g_num_fail++);
+
+static uint32_t g_num_pass = 0;
+static uint32_t g_num_fail = 0;
+
+/** The fake time base the timer service runs on */
+static uint64_t g_now;
+
+uint64_t get_ticks(void)
+{
+    return g_now;
+}
+
+/** Firing log, the timer and time of each callback */
+#define MAX_FIRED  (16)
+static swtimer_t *g_fired[MAX_FIRED];
+static uint64_t g_fired_at[MAX_FIRED];
+static uint32_t g_num_fired;
+
+static void log_fired(swtimer_t *timer)
+{
+    if (g_num_fired < MAX_FIRED) {
+        g_fired[g_num_fired] = timer;
+        g_fired_at[g_num_fired] = g_now;
+    }
+    g_num_fired++;
+}
+
+static void stop_fired(swtimer_t *timer)
+{
+    log_fired(timer);
+    swtimer_stop(timer);
+}
+
+static void reset(uint64_t now)
+{
+    g_now = now;
+    g_num_fired = 0;
+}
+
+/** Advance the time a ms at a time, running the timers like the main loop */
+static void run_until(uint64_t until)
+{
+    while (g_now < until) {
+        g_now++;
+        swtimer_run();
+    }
+}
+
+static bool test_one_shot(void)
+{
+    swtimer_t timer = { .callback = &log_fired };
+    reset(1000);
+    swtimer_start(&timer, 50, 0);
+    if (swtimer_next_deadline() != 1050) {
+        return false;
+    }
+    run_until(1049);
+    if (g_num_fired != 0) {
+        return false;
+    }
+    run_until(1200);
+    return g_num_fired == 1 && g_fired_at[0] == 1050 && !timer.is_active &&
+           swtimer_next_deadline() == SWTIMER_NO_DEADLINE;
+}
+
+static bool test_periodic(void)
+{
+    swtimer_t timer = { .callback = &log_fired };
+    reset(0);
+    swtimer_start(&timer, 10, 100);
+    run_until(320);
+    swtimer_stop(&timer);
+    run_until(1000);
+    return g_num_fired == 4 && g_fired_at[0] == 10 && g_fired_at[1] == 110 &&
+           g_fired_at[2] == 210 && g_fired_at[3] == 310 &&
+           swtimer_next_deadline() == SWTIMER_NO_DEADLINE;
+}
+
+static bool test_periodic_late(void)
+{
+    swtimer_t timer = { .callback = &log_fired };
+    reset(0);
+    swtimer_start(&timer, 100, 100);
+    /** The main loop was busy for 250ms, the timer fires once and then
+        continues a period later instead of catching up */
+    g_now = 350;
+    swtimer_run();
+    run_until(460);
+    swtimer_stop(&timer);
+    return g_num_fired == 2 && g_fired_at[0] == 350 && g_fired_at[1] == 450;
+}
+
+static bool test_order(void)
+{
+    swtimer_t a = { .callback = &log_fired };
+    swtimer_t b = { .callback = &log_fired };
+    swtimer_t c = { .callback = &log_fired };
+    reset(0);
+    swtimer_start(&a, 30, 0);
+    swtimer_start(&b, 10, 0);
+    swtimer_start(&c, 20, 0);
+    if (swtimer_next_deadline() != 10) {
+        return false;
+    }
+    /** All three are due in the same run */
+    g_now = 30;
+    swtimer_run();
+    return g_num_fired == 3 && g_fired[0] == &b && g_fired[1] == &c && g_fired[2] == &a;
+}
+
+static bool test_restart(void)
+{
+    swtimer_t a = { .callback = &log_fired };
+    swtimer_t b = { .callback = &log_fired };
+    reset(0);
+    swtimer_start(&a, 10, 0);
+    swtimer_start(&b, 20, 0);
+    /** Restarting moves a running timer, it is not added twice */
+    swtimer_start(&a, 30, 0);
+    if (swtimer_next_deadline() != 20) {
+        return false;
+    }
+    run_until(100);
+    return g_num_fired == 2 && g_fired[0] == &b && g_fired[1] == &a && g_fired_at[1] == 30;
+}
+
+static bool test_stop_in_callback(void)
+{
+    swtimer_t timer = { .callback = &stop_fired };
+    reset(0);
+    swtimer_start(&timer, 5, 5);
+    run_until(100);
+    /** Stopping a stopped timer is fine */
+    swtimer_stop(&timer);
+    return g_num_fired == 1 && !timer.is_active && swtimer_next_deadline() == SWTIMER_NO_DEADLINE;
+}
+
+int main(int argc, char const *argv[])
+{
+    (void) argc;
+    (void) argv;
+
+    RUN_TEST(test_one_shot);
+    RUN_TEST(test_periodic);
+    RUN_TEST(test_periodic_late);
+    RUN_TEST(test_order);
+    RUN_TEST(test_restart);
+    RUN_TEST(test_stop_in_callback);
+
+    printf("\n");
+    if (g_num_fail == 0) {
+        printf("All tests passed\n");
+    } else if (g_num_pass == 0) {
+        printf("All tests failed!\n");
+    } else {
+        printf ("%d/%d test failed\n", g_num_fail, g_num_pass);
+    }
+    printf("\n");
+
+    return g_num_fail ? 1 : 0;
+}
@@ -32,6 +32,7 @@
 #include <gpio.h>
 #include <nvic.h>
 #include <exti.h>
+#include <dwt.h>
 #include "spi_driver.h"
 #include "cli.h"
 #include "hw.h"
@@ -43,22 +44,66 @@
 #include "font-meter_large.h"
 #include "dbg_printf.h"
 #include "gfx_lookup.h"
+#include "tick.h"
+#include "profile.h"
+
+/** Display width, which is also the size of the scroll area */
+#define TFT_WIDTH  (128)
 
 static bool is_inverted;
 
+/** Bumped whenever the screen contents can no longer be trusted by items that
+    only redraw what changed */
+static uint32_t generation = 1;
+
 #define ILI9163C_COLORSPACE_TWIDDLE(color) \
         (((COLORSPACE) == 0) \
             ? (((color) & 0xF800) >> 11) | ((color) & 0x07E0) | (((color) & 0x001F) << 11) \
             : (color))
 
-#define ILI9163C_COLOR_TO_BITMASK(color) ( \
-    ((ILI9163C_COLORSPACE_TWIDDLE(color) & 0xFF) << 8) | \
-    ((ILI9163C_COLORSPACE_TWIDDLE(color) >> 8) & 0xFF) )
+/** Glyphs are decoded in native byte order and sent in 16 bit SPI frames so
+    no byte swapping is needed */
+#define ILI9163C_COLOR_TO_BITMASK(color) ILI9163C_COLORSPACE_TWIDDLE(color)
 
 /** Buffers for speeding up drawing */
 
 static uint16_t blit_buffer[((4*FONT_METER_LARGE_MAX_GLYPH_WIDTH*FONT_METER_LARGE_MAX_GLYPH_HEIGHT)+3)/4]; // Alignment for being able to lay down uint64_t in one go, without dealing with padding
 
+/** Glyphs are drawn by decoding into alternating halves of the blit buffer, so
+    one half is decoded while the other is on its way to the display. The stage
+    size is kept a multiple of 4 pixels (one source byte) for 32 bit alignment. */
+#define GLYPH_STAGE_PIXELS ((sizeof(blit_buffer) / sizeof(uint16_t) / 2) & ~3)
+static uint8_t stage_marker[2];
+static uint8_t stage_next;
+
+#ifdef CONFIG_GLYPH_CACHE
+
+/** Max number of glyphs in the cache */
+#define GLYPH_CACHE_ENTRIES (16)
+
+/** A decoded glyph in the cache pool */
+typedef struct {
+    uint16_t offset; /** In the pool, in pixels */
+    uint16_t len; /** In pixels, always even */
+    uint16_t color;
+    uint16_t last_used;
+    uint8_t size;
+    char ch;
+    bool invert;
+} glyph_cache_entry_t;
+
+/** The decoded glyphs are packed from the start of the pool in entry order.
+    Cached glyphs are sent straight from the pool by DMA so the pool is only
+    compacted after waiting for the SPI. */
+static uint32_t glyph_cache_pool[CONFIG_GLYPH_CACHE_SIZE / 4];
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_ENTRIES];
+static uint32_t glyph_cache_count;
+static uint16_t glyph_cache_clock;
+static uint32_t glyph_cache_hits;
+static uint32_t glyph_cache_misses;
+
+#endif // CONFIG_GLYPH_CACHE
+
 /**
   * @brief Initialize the TFT module
   * @retval none
@@ -76,25 +121,66 @@ void tft_init(void)
   */
 void tft_clear(void)
 {
+    tft_scroll(0);
     ili9163c_fill_screen(BLACK);
+    tft_invalidate();
 }
 
 /**
-  * @brief Decode 2bpp glyph to TFT-native bgr565 format into the tft's blit_buffer
+  * @brief Tell items caching what they have drawn that the screen has been
+  *        overwritten and needs a full redraw
+  * @retval none
+  */
+void tft_invalidate(void)
+{
+    generation++;
+}
+
+/**
+  * @brief Get the screen generation, which changes on every tft_invalidate
+  * @retval the generation (never 0)
+  */
+uint32_t tft_get_generation(void)
+{
+    return generation;
+}
+
+/**
+  * @brief Check if an icon spot needs to be sent to the display because the
+  *        icon changed or the screen was invalidated since it was drawn.
+  *        If so the spot is recorded as drawn and the caller must draw it.
+  * @param spot the icon spot
+  * @param icon the icon that should be shown, NULL for a blank spot
+  * @retval true if the icon must be drawn
+  */
+bool tft_icon_changed(tft_icon_spot_t *spot, const uint16_t *icon)
+{
+    if (spot->generation == generation && spot->icon == icon) {
+        return false;
+    }
+    spot->icon = icon;
+    spot->generation = generation;
+    return true;
+}
+
+/**
+  * @brief Decode 2bpp glyph to TFT-native bgr565 format
+  * @param target the target buffer (32 bit aligned)
+  * @param target_size size of the target buffer in bytes, wiped for spaces
   * @param pixdata the input bytes from the font definition
   * @param nbytes number of bytes in the source glyph array
   * @param invert whether to invert the glyph
   * @param color color mask to use when decoding
   * @retval none
   */
-void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16_t color)
+static void decode_glyph(uint16_t *target, size_t target_size, const uint8_t *pixdata, size_t nbytes, bool invert, uint16_t color)
 {
     if(nbytes == 0) { /* we're attempting to draw a space */
         /** Wipe out the target buffer if we're drawing a space */
-        memset(blit_buffer, (invert ? WHITE : BLACK) & 0xFF, sizeof(blit_buffer));
+        memset(target, (invert ? WHITE : BLACK) & 0xFF, target_size);
     }
     else {
-        uint32_t *target32 = (uint32_t*)blit_buffer;
+        uint32_t *target32 = (uint32_t*)target;
         if(invert) {
             for(size_t i = 0; i < nbytes; ++i) {
                 *target32++ = ~mono2bpp_lookup[pixdata[i] & 0xF];
@@ -123,6 +209,190 @@ void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16
     }
 }
 
+/**
+  * @brief Decode 2bpp glyph to TFT-native bgr565 format into the tft's blit_buffer
+  * @param pixdata the input bytes from the font definition
+  * @param nbytes number of bytes in the source glyph array
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval none
+  */
+void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16_t color)
+{
+    /** The previous glyph may still be on its way to the display */
+    spi_dma_fence();
+    decode_glyph(blit_buffer, sizeof(blit_buffer), pixdata, nbytes, invert, color);
+}
+
+#ifdef CONFIG_GLYPH_CACHE
+
+/**
+  * @brief Drop a glyph from the cache and compact the pool
+  * @param index index of the entry to drop
+  * @retval none
+  */
+static void glyph_cache_evict(uint32_t index)
+{
+    uint16_t *pool = (uint16_t*) glyph_cache_pool;
+    glyph_cache_entry_t *entry = &glyph_cache[index];
+    uint32_t end = glyph_cache_count ? glyph_cache[glyph_cache_count-1].offset + glyph_cache[glyph_cache_count-1].len : 0;
+    uint32_t tail = entry->offset + entry->len;
+    uint16_t len = entry->len;
+    memmove(&pool[entry->offset], &pool[tail], 2 * (end - tail));
+    for (uint32_t i = index + 1; i < glyph_cache_count; i++) {
+        glyph_cache[i].offset -= len;
+        glyph_cache[i-1] = glyph_cache[i];
+    }
+    glyph_cache_count--;
+}
+
+/**
+  * @brief Get a decoded glyph from the cache, decoding it into the cache on a miss
+  * @param size font size
+  * @param ch the character
+  * @param pixdata the input bytes from the font definition
+  * @param nbytes number of bytes in the source glyph array
+  * @param num_pixels number of pixels in the glyph
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval the decoded glyph or NULL if it does not fit in the cache
+  */
+static const uint16_t *glyph_cache_get(tft_font_size_t size, char ch, const uint8_t *pixdata, size_t nbytes, uint32_t num_pixels, bool invert, uint16_t color)
+{
+    uint16_t *pool = (uint16_t*) glyph_cache_pool;
+    uint32_t len = nbytes ? 4 * nbytes : num_pixels;
+    if (len < num_pixels) {
+        len = num_pixels;
+    }
+    len = (len + 1) & ~1; /** Keep the entries 32 bit aligned for the decoder */
+
+    for (uint32_t i = 0; i < glyph_cache_count; i++) {
+        glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->size == size && entry->ch == ch && entry->invert == invert && entry->color == color) {
+            entry->last_used = ++glyph_cache_clock;
+            glyph_cache_hits++;
+            return &pool[entry->offset];
+        }
+    }
+    glyph_cache_misses++;
+
+    if (len > sizeof(glyph_cache_pool) / 2) {
+        return 0;
+    }
+
+    uint32_t end = glyph_cache_count ? glyph_cache[glyph_cache_count-1].offset + glyph_cache[glyph_cache_count-1].len : 0;
+    if (glyph_cache_count == GLYPH_CACHE_ENTRIES || end + len > sizeof(glyph_cache_pool) / 2) {
+        /** Cached glyphs may be queued for the display, wait before moving them */
+        spi_dma_fence();
+        while (glyph_cache_count == GLYPH_CACHE_ENTRIES || end + len > sizeof(glyph_cache_pool) / 2) {
+            uint32_t lru = 0;
+            for (uint32_t i = 1; i < glyph_cache_count; i++) {
+                if ((uint16_t) (glyph_cache_clock - glyph_cache[i].last_used) > (uint16_t) (glyph_cache_clock - glyph_cache[lru].last_used)) {
+                    lru = i;
+                }
+            }
+            glyph_cache_evict(lru);
+            end = glyph_cache_count ? glyph_cache[glyph_cache_count-1].offset + glyph_cache[glyph_cache_count-1].len : 0;
+        }
+    }
+
+    glyph_cache_entry_t *entry = &glyph_cache[glyph_cache_count++];
+    entry->offset = end;
+    entry->len = len;
+    entry->color = color;
+    entry->last_used = ++glyph_cache_clock;
+    entry->size = size;
+    entry->ch = ch;
+    entry->invert = invert;
+    decode_glyph(&pool[end], 2 * len, pixdata, nbytes, invert, color);
+    return &pool[end];
+}
+
+/**
+  * @brief Drop all glyphs from the cache
+  * @retval none
+  */
+static void glyph_cache_flush(void)
+{
+    spi_dma_fence();
+    glyph_cache_count = 0;
+}
+
+/**
+  * @brief Get glyph cache statistics
+  * @param hits (out) number of glyphs drawn from the cache
+  * @param misses (out) number of glyphs decoded
+  * @param used (out) bytes of the cache in use
+  * @retval none
+  */
+void tft_get_glyph_cache_stats(uint32_t *hits, uint32_t *misses, uint32_t *used)
+{
+    *hits = glyph_cache_hits;
+    *misses = glyph_cache_misses;
+    *used = glyph_cache_count ? 2 * (glyph_cache[glyph_cache_count-1].offset + glyph_cache[glyph_cache_count-1].len) : 0;
+}
+
+#endif // CONFIG_GLYPH_CACHE
+
+/**
+  * @brief Decode a glyph and send it to the display, decoding of each stage
+  *        overlaps with sending the previous one
+  * @param pixdata the input bytes from the font definition
+  * @param nbytes number of bytes in the source glyph array
+  * @param num_pixels number of pixels in the glyph
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval none
+  */
+static void stream_glyph(const uint8_t *pixdata, size_t nbytes, uint32_t num_pixels, bool invert, uint16_t color)
+{
+    if (nbytes == 0) { /* we're attempting to draw a space */
+        ili9163c_push_colors(invert ? WHITE : BLACK, num_pixels);
+        return;
+    }
+    while (nbytes && num_pixels) {
+        uint16_t *stage = &blit_buffer[stage_next * GLYPH_STAGE_PIXELS];
+        size_t chunk = nbytes < GLYPH_STAGE_PIXELS / 4 ? nbytes : GLYPH_STAGE_PIXELS / 4;
+        uint32_t pixels = num_pixels < 4 * chunk ? num_pixels : 4 * chunk;
+        /** Wait for the stage to be sent the last time it was used */
+        spi_dma_wait(stage_marker[stage_next]);
+        decode_glyph(stage, 8 * chunk, pixdata, chunk, invert, color);
+        ili9163c_push_pixels(stage, pixels);
+        stage_marker[stage_next] = spi_dma_marker();
+        stage_next ^= 1;
+        pixdata += chunk;
+        nbytes -= chunk;
+        num_pixels -= pixels;
+    }
+}
+
+/**
+  * @brief Send a glyph to the display window, from the glyph cache if enabled
+  * @param size font size
+  * @param ch the character
+  * @param num_pixels number of pixels in the glyph
+  * @param invert whether to invert the glyph
+  * @param color color mask to use when decoding
+  * @retval none
+  */
+static void draw_glyph(tft_font_size_t size, char ch, uint32_t num_pixels, bool invert, uint16_t color)
+{
+    uint32_t glyph_size;
+    const uint8_t *glyph_pixdata;
+    tft_get_glyph_pixdata(size, ch, &glyph_pixdata, &glyph_size);
+#ifdef CONFIG_GLYPH_CACHE
+    /** Large meter glyphs would crowd out everything else in the cache */
+    if (size != FONT_METER_LARGE) {
+        const uint16_t *cached = glyph_cache_get(size, ch, glyph_pixdata, glyph_size, num_pixels, invert, color);
+        if (cached) {
+            ili9163c_push_pixels(cached, num_pixels);
+            return;
+        }
+    }
+#endif // CONFIG_GLYPH_CACHE
+    stream_glyph(glyph_pixdata, glyph_size, num_pixels, invert, color);
+}
+
 /**
   * @brief Blit graphics on TFT
   * @param bits graphics in bgr565 format mathing the specified size
@@ -131,12 +401,47 @@ void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16
   * @param x x position
   * @param y y position
   * @retval none
+  * @note The graphics are sent in the background and must remain valid
   */
 void tft_blit(uint16_t *bits, uint32_t width, uint32_t height, uint32_t x, uint32_t y)
 {
+    PROFILE_START(profile, profile_blit, NULL, PROFILE_NO_ITEM);
     ili9163c_set_window(x, y, x + width-1, y + height-1);
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    (void) spi_dma_transceive((uint8_t*) bits, 2*width*height, 0, 0);
+    ili9163c_push_bytes((uint8_t*) bits, width*height);
+    PROFILE_STOP(profile);
+}
+
+/**
+  * @brief Blit run length encoded graphics on TFT
+  * @param rle the encoded graphics, width*height pixels
+  * @param width width of data
+  * @param height of data
+  * @param x x position
+  * @param y y position
+  * @retval none
+  * @note The graphics are sent in the background and must remain valid
+  */
+void tft_blit_rle(const uint16_t *rle, uint32_t width, uint32_t height, uint32_t x, uint32_t y)
+{
+    uint32_t remaining = width * height;
+    PROFILE_START(profile, profile_blit_rle, NULL, PROFILE_NO_ITEM);
+    ili9163c_set_window(x, y, x + width-1, y + height-1);
+    while (remaining) {
+        uint32_t count = *rle & TFT_RLE_MAX_COUNT;
+        if (count == 0 || count > remaining) {
+            dbg_printf("Bad RLE packet 0x%04x\n", *rle);
+            break;
+        }
+        if (*rle & TFT_RLE_RUN) {
+            ili9163c_push_colors(rle[1], count);
+            rle += 2;
+        } else {
+            ili9163c_push_pixels(&rle[1], count);
+            rle += 1 + count;
+        }
+        remaining -= count;
+    }
+    PROFILE_STOP(profile);
 }
 
 /**
@@ -242,9 +547,8 @@ void tft_get_glyph_pixdata(tft_font_size_t size, char ch, const uint8_t **glyph_
   */
 uint8_t tft_putch(tft_font_size_t size, char ch, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color, bool invert)
 {
-    uint32_t glyph_width, glyph_height, glyph_size;
+    uint32_t glyph_width, glyph_height;
     uint32_t xpos, ypos;
-    const uint8_t *glyph_pixdata;
 
     /** Get the glyph metrics */
     tft_get_glyph_metrics(size, ch, &glyph_width, &glyph_height);
@@ -255,18 +559,14 @@ uint8_t tft_putch(tft_font_size_t size, char ch, uint32_t x, uint32_t y, uint32_
         return 0;
     }
 
-    /** Get the glyph data and decode it to the native TFT format */
-    tft_get_glyph_pixdata(size, ch, &glyph_pixdata, &glyph_size);
-    tft_decode_glyph(glyph_pixdata, glyph_size, invert, color);
-
     /** Position glyph in center of region */
     xpos = x+(w-glyph_width)/2;
     ypos = y+(h-glyph_height)/2;
 
     /** Draw the glyph */
+    PROFILE_START(profile, profile_putch, NULL, PROFILE_NO_ITEM);
     ili9163c_set_window(xpos, ypos, xpos + glyph_width-1, ypos + glyph_height-1);
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    (void) spi_dma_transceive((uint8_t*) blit_buffer, sizeof(uint16_t) * glyph_width * glyph_height, 0, 0);
+    draw_glyph(size, ch, glyph_width * glyph_height, invert, color);
 
     /** If our glyph hasn't filled the entire region fill the remainder in with black or white depending on if we're inverting */
     uint16_t fill_color = invert ? WHITE : BLACK;
@@ -276,6 +576,7 @@ uint8_t tft_putch(tft_font_size_t size, char ch, uint32_t x, uint32_t y, uint32_
     if (xpos+glyph_width < x+w) {
         tft_fill(xpos+glyph_width, y, (w-glyph_width+1)/2, h, fill_color);
     }
+    PROFILE_STOP(profile);
 
     return glyph_width;
 }
@@ -338,10 +639,10 @@ uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y,
     tft_get_glyph_metrics(size, ' ', &space_width, &font_height);
     xpos = x;
     ypos = y - font_height;
+    PROFILE_START(profile, profile_puts, NULL, PROFILE_NO_ITEM);
 
     while(str && *str) {
-        uint32_t glyph_width, glyph_height, glyph_size;
-        const uint8_t *glyph_pixdata;
+        uint32_t glyph_width, glyph_height;
 
         if(!first) {
             tft_fill(xpos, ypos, spacing, h, invert ? WHITE : BLACK);
@@ -364,23 +665,19 @@ uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y,
         if(glyph_width > draw_remainder) {
             tft_fill(xpos, ypos, draw_remainder, glyph_height, invert ? WHITE : BLACK);
             xpos += draw_remainder;
-            return xpos - x;
+            break;
         }
 
-        /** Get the glyph data and decode it to the native TFT format */
-        tft_get_glyph_pixdata(size, *str, &glyph_pixdata, &glyph_size);
-        tft_decode_glyph(glyph_pixdata, glyph_size, invert, color);
-
         /** Draw the glyph */
         ili9163c_set_window(xpos, ypos, xpos + glyph_width-1, ypos + glyph_height-1);
-        gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-        (void) spi_dma_transceive((uint8_t*) blit_buffer, sizeof(uint16_t) * glyph_width * glyph_height, 0, 0);
+        draw_glyph(size, *str, glyph_width * glyph_height, invert, color);
 
         xpos += glyph_width;
 
         first = false;
         ++str;
     }
+    PROFILE_STOP(profile);
 
     return xpos - x;
 }
@@ -392,16 +689,29 @@ uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y,
   * @param fill buffer to fill from (needs not match the described area)
   * @param fill_size size of buffer
   * @retval none
+  * @note The buffer is sent in the background and must remain valid
   */
 void tft_fill_pattern(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint8_t *fill, uint32_t fill_size)
 {
     uint32_t count = 2*(x2-x1+1)*(y2-y1+1);
     ili9163c_set_window(x1, y1, x2, y2);
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    while(count) {
-        uint32_t c = count < fill_size ? count : fill_size;
-        (void) spi_dma_transceive((uint8_t*) fill, c, 0, 0);
-        count -= c;
+    /** A pattern of a single color is sent as one fill */
+    uint32_t i = 2;
+    while (i + 1 < fill_size && fill[i] == fill[0] && fill[i+1] == fill[1]) {
+        i += 2;
+    }
+    if (fill_size >= 2 && i + 1 >= fill_size) {
+        ili9163c_push_colors((fill[0] << 8) | fill[1], count / 2);
+        return;
+    }
+    if (fill_size > 0xffff) {
+        fill_size = 0xffff;
+    }
+    if (count / fill_size) {
+        (void) spi_dma_queue(fill, fill_size, count / fill_size, true);
+    }
+    if (count % fill_size) {
+        (void) spi_dma_queue(fill, count % fill_size, 1, true);
     }
 }
 
@@ -415,17 +725,11 @@ void tft_fill_pattern(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint8_
   */
 void tft_fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color)
 {
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xff;
-    int32_t count = 2 * w * h;
-    uint8_t fill[] = {hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo, hi, lo};
-    ili9163c_set_window(x, y, x+w-1, y+h-1);
-    gpio_set(TFT_A0_PORT, TFT_A0_PIN);
-    while (count > 0) {
-        uint32_t len = (uint32_t) count > sizeof(fill) ? sizeof(fill) : (uint32_t) count;
-        (void) spi_dma_transceive((uint8_t*) fill, len, 0, 0);
-        count -= len;
+    if (!w || !h) {
+        return;
     }
+    ili9163c_set_window(x, y, x+w-1, y+h-1);
+    ili9163c_push_colors(color, w * h);
 }
 
 /**
@@ -444,6 +748,46 @@ void tft_rect(uint32_t xpos, uint32_t ypos, uint32_t width, uint32_t height, uin
     ili9163c_draw_vline(xpos + width, ypos, height, color);
 }
 
+/**
+  * @brief Draw a one pixel wide column as runs of colors, top to bottom
+  * @param x x position
+  * @param y y position of the top pixel
+  * @param runs length of each run
+  * @param colors color of each run in bgr565 format
+  * @param num_runs number of runs
+  * @retval none
+  */
+void tft_column(uint32_t x, uint32_t y, const uint8_t *runs, const uint16_t *colors, uint32_t num_runs)
+{
+    uint32_t height = 0;
+    for (uint32_t i = 0; i < num_runs; i++) {
+        height += runs[i];
+    }
+    if (!height) {
+        return;
+    }
+    ili9163c_set_window(x, y, x, y + height-1);
+    /** Fills are copied into the DMA queue, the caller may reuse its buffers */
+    for (uint32_t i = 0; i < num_runs; i++) {
+        if (runs[i]) {
+            ili9163c_push_colors(colors[i], runs[i]);
+        }
+    }
+}
+
+/**
+  * @brief Scroll the whole display horizontally using the display controller.
+  *        Columns scrolled out on the left come back in on the right so
+  *        only columns with new content need to be drawn. Drawing positions
+  *        are not affected, tft_clear() resets the scroll.
+  * @param x the column shown at the left edge of the display
+  * @retval none
+  */
+void tft_scroll(uint32_t x)
+{
+    ili9163c_set_scroll(TFT_SCROLL_LINES(x, TFT_WIDTH));
+}
+
 /**
   * @brief Invert display
   * @param invert true to invert, false to restore
@@ -453,6 +797,10 @@ void tft_invert(bool invert)
 {
     ili9163c_invert_display(invert);
     is_inverted = invert;
+#ifdef CONFIG_GLYPH_CACHE
+    /** Colored glyphs are decoded differently when inverted */
+    glyph_cache_flush();
+#endif // CONFIG_GLYPH_CACHE
 }
 
 /**
@@ -463,3 +811,63 @@ bool tft_is_inverted(void)
 {
     return is_inverted;
 }
+
+/**
+  * @brief Measure display throughput, leaves the screen cleared
+  * @param fill_pps (out) pixels per second for solid fills
+  * @param blit_pps (out) pixels per second for glyph decode and blit
+  * @param string_cycles (out) CPU cycles to draw a large meter string, until
+  *        it has been sent to the display
+  * @retval none
+  */
+void tft_benchmark(uint32_t *fill_pps, uint32_t *blit_pps, uint32_t *string_cycles)
+{
+    uint16_t screen_w, screen_h;
+    uint32_t glyph_width, glyph_height, glyph_size;
+    const uint8_t *glyph_pixdata;
+    uint32_t pixels = 0;
+    uint64_t start;
+    uint32_t elapsed;
+
+    ili9163c_get_geometry(&screen_w, &screen_h);
+
+    start = get_ticks();
+    for (uint32_t i = 0; i < 16; i++) {
+        tft_fill(0, 0, screen_w, screen_h, i & 1 ? WHITE : BLACK);
+        pixels += screen_w * screen_h;
+    }
+    spi_dma_fence();
+    elapsed = get_ticks() - start;
+    *fill_pps = elapsed ? (uint64_t) pixels * 1000 / elapsed : 0;
+
+    tft_get_glyph_metrics(FONT_METER_LARGE, '8', &glyph_width, &glyph_height);
+    tft_get_glyph_pixdata(FONT_METER_LARGE, '8', &glyph_pixdata, &glyph_size);
+    pixels = 0;
+    start = get_ticks();
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t x = (i * glyph_width) % (screen_w - glyph_width);
+        tft_decode_glyph(glyph_pixdata, glyph_size, false, WHITE);
+        ili9163c_set_window(x, 0, x + glyph_width-1, glyph_height-1);
+        ili9163c_push_pixels(blit_buffer, glyph_width * glyph_height);
+        pixels += glyph_width * glyph_height;
+    }
+    spi_dma_fence();
+    elapsed = get_ticks() - start;
+    *blit_pps = elapsed ? (uint64_t) pixels * 1000 / elapsed : 0;
+
+    /** Per string cycle count, with the glyphs decoded every time */
+    uint64_t cycles = 0;
+    dwt_enable_cycle_counter();
+    for (uint32_t i = 0; i < 16; i++) {
+#ifdef CONFIG_GLYPH_CACHE
+        glyph_cache_flush();
+#endif // CONFIG_GLYPH_CACHE
+        uint32_t cycle_start = dwt_read_cycle_counter();
+        tft_puts(FONT_METER_LARGE, "88.88", 0, glyph_height, screen_w, glyph_height, WHITE, false);
+        spi_dma_fence();
+        cycles += dwt_read_cycle_counter() - cycle_start;
+    }
+    *string_cycles = cycles / 16;
+
+    tft_clear();
+}
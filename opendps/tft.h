@@ -33,6 +33,16 @@ typedef enum
     FONT_METER_LARGE
 } tft_font_size_t;
 
+/** Run length encoded graphics, see tft_blit_rle(...) */
+#define TFT_RLE_RUN       (0x8000)
+#define TFT_RLE_MAX_COUNT (0x7fff)
+
+/** Display controller scroll start that shows column x at the left edge of a
+    scroll area w columns wide. The scroll area is the vertical GRAM address
+    range, with the DPS rotation (row/column exchange and row mirroring) it
+    runs from right to left across the display so the start moves backwards */
+#define TFT_SCROLL_LINES(x, w)  (((w) - (x) % (w)) % (w))
+
 /**
   * @brief Initialize the TFT module
   * @retval none
@@ -45,6 +55,35 @@ void tft_init(void);
   */
 void tft_clear(void);
 
+/**
+  * @brief Tell items caching what they have drawn that the screen has been
+  *        overwritten and needs a full redraw
+  * @retval none
+  */
+void tft_invalidate(void);
+
+/**
+  * @brief Get the screen generation, which changes on every tft_invalidate
+  * @retval the generation (never 0)
+  */
+uint32_t tft_get_generation(void);
+
+/** What was last drawn at a fixed icon position, see tft_icon_changed(...) */
+typedef struct {
+    const uint16_t *icon; /** The icon drawn, NULL if the spot was blanked */
+    uint32_t generation; /** Screen generation of the draw, 0 if never drawn */
+} tft_icon_spot_t;
+
+/**
+  * @brief Check if an icon spot needs to be sent to the display because the
+  *        icon changed or the screen was invalidated since it was drawn.
+  *        If so the spot is recorded as drawn and the caller must draw it.
+  * @param spot the icon spot
+  * @param icon the icon that should be shown, NULL for a blank spot
+  * @retval true if the icon must be drawn
+  */
+bool tft_icon_changed(tft_icon_spot_t *spot, const uint16_t *icon);
+
 /**
   * @brief Determine glyph spacing given the font size
   * @param size font size
@@ -90,9 +129,26 @@ void tft_decode_glyph(const uint8_t *pixdata, size_t nbytes, bool invert, uint16
   * @param x x position
   * @param y y position
   * @retval none
+  * @note The graphics are sent in the background and must remain valid
   */
 void tft_blit(uint16_t *bits, uint32_t width, uint32_t height, uint32_t x, uint32_t y);
 
+/**
+  * @brief Blit run length encoded graphics on TFT, as generated by gen_lookup.py.
+  *        The data is a sequence of packets, each starting with a header word:
+  *         - TFT_RLE_RUN | n: a run, the next word is a bgr565 pixel repeated n times
+  *         - n: a literal, the next n words are bgr565 pixels
+  *        Runs are sent as fills and literals are DMA'd straight from the data.
+  * @param rle the encoded graphics, width*height pixels
+  * @param width width of data
+  * @param height of data
+  * @param x x position
+  * @param y y position
+  * @retval none
+  * @note The graphics are sent in the background and must remain valid
+  */
+void tft_blit_rle(const uint16_t *rle, uint32_t width, uint32_t height, uint32_t x, uint32_t y);
+
 /**
   * @brief Blit character on TFT
   * @param size font size used
@@ -138,6 +194,7 @@ uint16_t tft_puts(tft_font_size_t size, const char *str, uint32_t x, uint32_t y,
   * @param fill buffer to fill from (needs not match the described area)
   * @param fill_size size of buffer
   * @retval none
+  * @note The buffer is sent in the background and must remain valid
   */
 void tft_fill_pattern(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint8_t *fill, uint32_t fill_size);
 
@@ -161,6 +218,27 @@ void tft_fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color);
   */
 void tft_rect(uint32_t xpos, uint32_t ypos, uint32_t width, uint32_t height, uint16_t color);
 
+/**
+  * @brief Draw a one pixel wide column as runs of colors, top to bottom
+  * @param x x position
+  * @param y y position of the top pixel
+  * @param runs length of each run
+  * @param colors color of each run in bgr565 format
+  * @param num_runs number of runs
+  * @retval none
+  */
+void tft_column(uint32_t x, uint32_t y, const uint8_t *runs, const uint16_t *colors, uint32_t num_runs);
+
+/**
+  * @brief Scroll the whole display horizontally using the display controller.
+  *        Columns scrolled out on the left come back in on the right so
+  *        only columns with new content need to be drawn. Drawing positions
+  *        are not affected, tft_clear() resets the scroll.
+  * @param x the column shown at the left edge of the display
+  * @retval none
+  */
+void tft_scroll(uint32_t x);
+
 /**
   * @brief Invert display
   * @param invert true to invert, false to restore
@@ -174,8 +252,31 @@ void tft_invert(bool invert);
   */
 bool tft_is_inverted(void);
 
+#ifdef CONFIG_GLYPH_CACHE
+/**
+  * @brief Get glyph cache statistics
+  * @param hits (out) number of glyphs drawn from the cache
+  * @param misses (out) number of glyphs decoded
+  * @param used (out) bytes of the cache in use
+  * @retval none
+  */
+void tft_get_glyph_cache_stats(uint32_t *hits, uint32_t *misses, uint32_t *used);
+#endif // CONFIG_GLYPH_CACHE
+
+/**
+  * @brief Measure display throughput, leaves the screen cleared
+  * @param fill_pps (out) pixels per second for solid fills
+  * @param blit_pps (out) pixels per second for glyph decode and blit
+  * @param string_cycles (out) CPU cycles to draw a large meter string, until
+  *        it has been sent to the display
+  * @retval none
+  */
+void tft_benchmark(uint32_t *fill_pps, uint32_t *blit_pps, uint32_t *string_cycles);
+
 #ifdef DPS_EMULATOR
 void emul_tft_draw(void);
+void emul_tft_stats(void);
+bool emul_tft_save_ppm(const char *file_name);
 #endif // DPS_EMULATOR
 
 #endif // __TFT_H__
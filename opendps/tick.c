@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <systick.h>
 #include <nvic.h>
+#include <scb.h>
 #include "tick.h"
 
 static volatile uint32_t ticks_lower;
@@ -41,7 +42,7 @@ void systick_init(void)
 
     // 6000000/6000 = 1000 overflows per second - every 1ms one interrupt
     // SysTick interrupt every N clock pulses: set reload to N-1
-    systick_set_reload(5999);
+    systick_set_reload(TICK_COUNTS_PER_MS - 1);
 
     systick_interrupt_enable();
     systick_counter_enable();
@@ -60,16 +61,68 @@ void delay_ms(uint32_t delay)
     {}
 }
 
+/**
+  * @brief Read the tick counters and the systick counter value without
+  *        masking the systick interrupt. The upper word is read again and
+  *        the read is retried if the systick handler ran in between.
+  * @param ms (out) number of milliseconds since powerup
+  * @param value (out) systick counter value, counting down from the reload
+  * @retval none
+  */
+static void read_ticks(uint64_t *ms, uint32_t *value)
+{
+    uint32_t upper, lower, counts;
+    do {
+        upper = ticks_upper;
+        lower = ticks_lower;
+        counts = systick_get_value();
+    } while (upper != ticks_upper || lower != ticks_lower);
+    *ms = ((uint64_t) upper << 32) | lower;
+    /** The counter wrapped but the handler has not run yet, happens when
+        interrupts are masked */
+    if ((SCB_ICSR & SCB_ICSR_PENDSTSET) && counts > TICK_COUNTS_PER_MS / 2) {
+        (*ms)++;
+    }
+    *value = counts;
+}
+
 /**
   * @brief Get systick
   * @retval number of milliseconds since powerup
   */
 uint64_t get_ticks(void)
 {
-    systick_interrupt_disable();
-    uint64_t ticks = ((uint64_t) ticks_upper << 32) | ((uint64_t) ticks_lower);
-    systick_interrupt_enable();
-    return ticks;
+    uint32_t upper, lower;
+    do {
+        upper = ticks_upper;
+        lower = ticks_lower;
+    } while (upper != ticks_upper);
+    return ((uint64_t) upper << 32) | lower;
+}
+
+/**
+  * @brief Get a timestamp with microsecond resolution
+  * @retval number of microseconds since powerup
+  */
+uint64_t get_ticks_us(void)
+{
+    uint64_t ms;
+    uint32_t value;
+    read_ticks(&ms, &value);
+    return ms * 1000 + (TICK_COUNTS_PER_MS - 1 - value) / (TICK_COUNTS_PER_MS / 1000);
+}
+
+/**
+  * @brief Get a fine grained timestamp for measuring short intervals, also
+  *        correct when called with interrupts disabled
+  * @retval time in systick counts (TICK_COUNTS_PER_MS per ms), wraps
+  */
+uint32_t get_tick_counts(void)
+{
+    uint64_t ms;
+    uint32_t value;
+    read_ticks(&ms, &value);
+    return (uint32_t) ms * TICK_COUNTS_PER_MS + (TICK_COUNTS_PER_MS - 1 - value);
 }
 
 /**
@@ -27,6 +27,9 @@
 
 #include <stdint.h>
 
+/** Systick counts per millisecond, the resolution of get_tick_counts() */
+#define TICK_COUNTS_PER_MS  (6000)
+
 /**
   * @brief Initialize the systick module
   * @retval none
@@ -42,8 +45,21 @@ void delay_ms(uint32_t delay);
 
 /**
   * @brief Get systick
-  * @retval number of milliseconcs since powerup
+  * @retval number of milliseconds since powerup
   */
 uint64_t get_ticks(void);
 
+/**
+  * @brief Get a timestamp with microsecond resolution
+  * @retval number of microseconds since powerup
+  */
+uint64_t get_ticks_us(void);
+
+/**
+  * @brief Get a fine grained timestamp for measuring short intervals, also
+  *        correct when called with interrupts disabled
+  * @retval time in systick counts (TICK_COUNTS_PER_MS per ms), wraps
+  */
+uint32_t get_tick_counts(void);
+
 #endif // __TICK_H__
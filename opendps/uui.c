@@ -28,6 +28,7 @@
 #include "uui.h"
 #include "tft.h"
 #include "opendps.h"
+#include "profile.h"
 
 
 /**
@@ -62,6 +63,8 @@ void uui_init(uui_t *ui, past_t *past)
     ui->past = past;
     ui->num_screens = ui->cur_screen = 0;
     ui->is_visible = true;
+    ui->icon_spot.icon = NULL;
+    ui->icon_spot.generation = 0;
 }
 
 void uui_add_screen(uui_t *ui, ui_screen_t *screen)
@@ -87,15 +90,23 @@ void uui_refresh(uui_t *ui, bool force)
     assert(ui);
     ui_screen_t *screen = ui->screens[ui->cur_screen];
     assert(screen);
+    if (force) {
+        tft_invalidate();
+    }
     for (uint8_t i = 0; i < screen->num_items; i++) {
         ui_item_t *item = screen->items[i];
         if (force || item->needs_redraw) {
             assert(item->draw);
+            PROFILE_START(profile, profile_item_draw, screen->name, i);
             item->draw(item);
+            PROFILE_STOP(profile);
             item->needs_redraw = false;
         }
     }
-    tft_blit((uint16_t*) screen->icon_data, screen->icon_width, screen->icon_height, XPOS_ICON, 128-screen->icon_height);
+    /** The icon only needs to be sent when the screen changed or was cleared */
+    if (screen->icon_data && tft_icon_changed(&ui->icon_spot, screen->icon_data)) {
+        tft_blit_rle(screen->icon_data, screen->icon_width, screen->icon_height, XPOS_ICON, 128-screen->icon_height);
+    }
 }
 
 void uui_activate(uui_t *ui)
@@ -113,7 +124,6 @@ void uui_activate(uui_t *ui)
         }
         /** @todo: add activation callback for each screen allowing for updating of U/I settings */
         uui_refresh(ui, true);
-        tft_blit((uint16_t*) screen->icon_data, screen->icon_width, screen->icon_height, XPOS_ICON, 128-screen->icon_height);
         if (screen->activated) {
             screen->activated();
         }
@@ -195,15 +205,7 @@ void uui_handle_screen_event(uui_t *ui, event_t event)
         case event_button_enable:
         case event_ocp:
         case event_ovp:
-            /** If current screen can be enabled */
-            if (screen->enable) {
-                screen->is_enabled = !screen->is_enabled;
-                if (screen->is_enabled && screen->past_save) {
-                    screen->past_save(ui->past);
-                }
-                screen->enable(screen->is_enabled);
-                opendps_update_power_status(screen->is_enabled); /** @todo: move */
-            }
+            (void) uui_enable_cur_screen(ui, !screen->is_enabled);
             break;
 
         default:
@@ -267,7 +269,10 @@ void ui_item_init(ui_item_t *item)
 
 void uui_tick(uui_t *ui)
 {
-    ui->screens[ui->cur_screen]->tick();
+    ui_screen_t *screen = ui->screens[ui->cur_screen];
+    PROFILE_START(profile, profile_screen_tick, screen->name, PROFILE_NO_ITEM);
+    screen->tick();
+    PROFILE_STOP(profile);
 }
 
 void uui_show(uui_t *ui, bool show)
@@ -275,6 +280,24 @@ void uui_show(uui_t *ui, bool show)
     ui->is_visible = show;
 }
 
+bool uui_enable_cur_screen(uui_t *ui, bool enable)
+{
+    ui_screen_t *screen = ui->screens[ui->cur_screen];
+    /** If current screen can be enabled */
+    if (!screen->enable) {
+        return false;
+    }
+    if (screen->is_enabled != enable) {
+        screen->is_enabled = enable;
+        if (screen->is_enabled && screen->past_save) {
+            screen->past_save(ui->past);
+        }
+        screen->enable(screen->is_enabled);
+        opendps_update_power_status(screen->is_enabled); /** @todo: move */
+    }
+    return screen->is_enabled;
+}
+
 void uui_disable_cur_screen(uui_t *ui)
 {
     ui_screen_t *screen = ui->screens[ui->cur_screen];
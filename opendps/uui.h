@@ -32,6 +32,7 @@
 #include "tick.h"
 #include "pwrctl.h"
 #include "past.h"
+#include "tft.h"
 
 #ifdef CONFIG_UI_MAX_SCREENS
  #define MAX_SCREENS (CONFIG_UI_MAX_SCREENS)
@@ -91,6 +92,7 @@ typedef enum {
 typedef enum {
     ui_item_number, /** A control for setting a value (ui_number_t) */
     ui_item_icon, /** A control for showing a icon (ui_icon_t) */
+    ui_item_chart, /** A scrolling strip chart (ui_chart_t) */
     ui_item_last = 0xff
 } ui_item_type_t;
 
@@ -155,11 +157,12 @@ typedef struct ui_item_t {
 struct ui_screen {
     uint8_t id; /** must be unique */
     char *name;
-    uint8_t *icon_data;
+    const uint16_t *icon_data;
     uint32_t icon_data_len;
     uint32_t icon_width;
     uint32_t icon_height;
     bool is_enabled;
+    bool is_fullscreen; /** The screen uses the whole display, the main UI is hidden while it is shown */
     uint8_t num_items;
     uint8_t cur_item;
     ui_parameter_t parameters[MAX_PARAMETERS];
@@ -183,6 +186,7 @@ typedef struct {
     bool is_visible;
     ui_screen_t *screens[MAX_SCREENS];
     past_t *past;
+    tft_icon_spot_t icon_spot; /** The screen icon last drawn */
 } uui_t;
 
 /**
@@ -266,6 +270,18 @@ void uui_tick(uui_t *ui);
  */
 void uui_show(uui_t *ui, bool show);
 
+/**
+ * @brief      Enable or disable the output of the current screen right away,
+ *             as the enable button does
+ *
+ * @param      ui      The user interface
+ * @param      enable  true to enable, false to disable
+ *
+ * @return     true if the current screen is enabled afterwards, false if
+ *             it is disabled or cannot be enabled
+ */
+bool uui_enable_cur_screen(uui_t *ui, bool enable);
+
 /**
  * @brief      Disable current screen of user interface
  *
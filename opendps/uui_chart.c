@@ -0,0 +1,162 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "my_assert.h"
+#include "uui_chart.h"
+#include "tft.h"
+
+/** Max number of color runs in a column, enough for a grid spacing of 8 */
+#define MAX_RUNS  (40)
+
+/**
+ * @brief      Draw one column of the chart, each trace is drawn as a line
+ *             from the sample in the previous column
+ *
+ * @param      item    The item
+ * @param[in]  column  The column
+ */
+static void chart_draw_column(ui_chart_t *item, uint32_t column)
+{
+    uint8_t runs[MAX_RUNS];
+    uint16_t colors[MAX_RUNS];
+    uint32_t num_runs = 0;
+    uint8_t lo[UI_CHART_TRACES];
+    uint8_t hi[UI_CHART_TRACES];
+    /** The column at the left edge holds the oldest sample, its previous
+        column holds the newest */
+    uint32_t prev = column == item->head ? column : (column + UI_CHART_WIDTH - 1) % UI_CHART_WIDTH;
+
+    for (uint32_t t = 0; t < UI_CHART_TRACES; t++) {
+        uint8_t cur = item->samples[t][column];
+        uint8_t last = item->samples[t][prev];
+        if (last == UI_CHART_NO_SAMPLE) {
+            last = cur;
+        }
+        lo[t] = cur < last ? cur : last;
+        hi[t] = cur < last ? last : cur;
+    }
+
+    /** Walk the column from the top and merge equal pixels into runs */
+    for (int32_t row = item->height - 1; row >= 0; row--) {
+        uint16_t color = item->bg_color;
+        if (item->grid_spacing && row % item->grid_spacing == 0) {
+            color = item->grid_color;
+        }
+        for (uint32_t t = 0; t < UI_CHART_TRACES; t++) {
+            if (lo[t] != UI_CHART_NO_SAMPLE && row >= lo[t] && row <= hi[t]) {
+                color = item->colors[t];
+            }
+        }
+        if (num_runs && colors[num_runs-1] == color) {
+            runs[num_runs-1]++;
+        } else if (num_runs == MAX_RUNS) {
+            runs[num_runs-1]++; /** Too fine grid, stretch the last run */
+        } else {
+            colors[num_runs] = color;
+            runs[num_runs++] = 1;
+        }
+    }
+    tft_column(column, item->ui.y, runs, colors, num_runs);
+}
+
+/**
+ * @brief      Draw all columns and scroll the oldest one to the left edge
+ *
+ * @param      _item  The item
+ */
+static void chart_draw(ui_item_t *_item)
+{
+    ui_chart_t *item = (ui_chart_t*) _item;
+    for (uint32_t column = 0; column < UI_CHART_WIDTH; column++) {
+        chart_draw_column(item, column);
+    }
+    tft_scroll(item->head);
+}
+
+/**
+ * @brief      Getter of our value
+ *
+ * @param      _item  The item
+ *
+ * @return     the number of the column the next sample goes into
+ */
+static uint32_t chart_get_value(ui_item_t *_item)
+{
+    assert(_item);
+    ui_chart_t *item = (ui_chart_t*) _item;
+    return item->head;
+}
+
+/**
+ * @brief      Remove all samples from the chart
+ *
+ * @param      item  The item
+ */
+void chart_clear(ui_chart_t *item)
+{
+    assert(item);
+    memset(item->samples, UI_CHART_NO_SAMPLE, sizeof(item->samples));
+    item->head = 0;
+    item->ui.needs_redraw = true;
+}
+
+/**
+ * @brief      Add a sample to each trace and scroll the chart one column
+ *
+ * @param      item    The item
+ * @param[in]  values  One value per trace
+ */
+void chart_add(ui_chart_t *item, const uint32_t values[UI_CHART_TRACES])
+{
+    assert(item);
+    for (uint32_t t = 0; t < UI_CHART_TRACES; t++) {
+        uint32_t full_scale = item->full_scale[t] ? item->full_scale[t] : 1;
+        uint32_t value = values[t] < full_scale ? values[t] : full_scale;
+        item->samples[t][item->head] = value * (item->height - 1) / full_scale;
+    }
+    /** The column at the left edge gets the new sample and is moved to the
+        right edge, the only column sent to the display */
+    uint32_t column = item->head;
+    item->head = (item->head + 1) % UI_CHART_WIDTH;
+    chart_draw_column(item, column);
+    tft_scroll(item->head);
+}
+
+/**
+ * @brief      Initialize chart item
+ *
+ * @param      item  The item
+ */
+void chart_init(ui_chart_t *item)
+{
+    assert(item);
+    assert(item->height > 0);
+    ui_item_init(&item->ui);
+    item->ui.get_value = &chart_get_value;
+    item->ui.draw = &chart_draw;
+    chart_clear(item);
+}
@@ -0,0 +1,84 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Johan Kanflo (github.com/kanflo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __UUI_CHART_H__
+#define __UUI_CHART_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tft.h"
+#include "uui.h"
+
+/** The chart scrolls the whole display and is therefore always this wide */
+#define UI_CHART_WIDTH  (128)
+
+/** Number of traces in a chart */
+#define UI_CHART_TRACES  (2)
+
+/** Marks a column without a sample */
+#define UI_CHART_NO_SAMPLE  (0xff)
+
+/**
+ * A UI item plotting measurements as a strip chart. Each new sample is drawn
+ * in one column and the display is scrolled by the display controller, so
+ * nothing else on the screen may share the chart's columns. The item is
+ * placed at x 0, only its y position is used.
+ */
+typedef struct ui_chart_t {
+    ui_item_t ui;
+    uint8_t height; /** Height in pixels, at most 255 */
+    uint8_t grid_spacing; /** Pixels between horizontal grid lines, 0 for no grid */
+    uint16_t bg_color;
+    uint16_t grid_color;
+    uint16_t colors[UI_CHART_TRACES];
+    uint32_t full_scale[UI_CHART_TRACES]; /** Value plotted at the top of the chart */
+    uint8_t head; /** Column the next sample goes into, shown at the left edge */
+    uint8_t samples[UI_CHART_TRACES][UI_CHART_WIDTH]; /** Row of each sample counted from the bottom */
+} ui_chart_t;
+
+/**
+ * @brief      Initialize chart UI item
+ *
+ * @param      item  The item
+ */
+void chart_init(ui_chart_t *item);
+
+/**
+ * @brief      Remove all samples from the chart, it is redrawn on the next
+ *             refresh
+ *
+ * @param      item  The item
+ */
+void chart_clear(ui_chart_t *item);
+
+/**
+ * @brief      Add a sample to each trace, draw it in the rightmost column and
+ *             scroll the oldest sample out on the left
+ *
+ * @param      item    The item
+ * @param[in]  values  One value per trace, in the unit of full_scale
+ */
+void chart_add(ui_chart_t *item, const uint32_t values[UI_CHART_TRACES]);
+
+#endif // __UUI_CHART_H__
@@ -90,7 +90,7 @@ static void icon_draw(ui_item_t *_item)
     assert(item->value < item->num_icons);
     /* Frame the icon */
     tft_rect(_item->x-1, _item->y-1, item->icons_width+2, item->icons_height+2, _item->has_focus ? WHITE : BLACK);
-    tft_blit((uint16_t*) item->icons[item->value], item->icons_width, item->icons_height, _item->x, _item->y);
+    tft_blit_rle(item->icons[item->value], item->icons_width, item->icons_height, _item->x, _item->y);
 }
 
 /**
@@ -44,7 +44,7 @@ typedef struct ui_icon_t {
     uint32_t value;
     uint32_t num_icons;
     void (*changed)(struct ui_icon_t *item);
-    const uint8_t *icons[];
+    const uint16_t *icons[];
 } ui_icon_t;
 
 /**
@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include "my_assert.h"
 #include "uui_number.h"
 #include "tft.h"
@@ -186,6 +187,31 @@ static uint32_t number_get_value(ui_item_t *_item)
     return item->value;
 }
 
+/**
+ * @brief      Check if a digit differs from what is on screen and record the
+ *             new glyph
+ *
+ * @param      item       The item
+ * @param[in]  digit      The digit, 0 is the right most
+ * @param[in]  glyph      The glyph to draw, 0 for a blank digit
+ * @param[in]  highlight  Whether the digit is highlighted
+ * @param[in]  full       Whether the whole item is being redrawn
+ *
+ * @return     true if the digit needs to be drawn
+ */
+static bool number_digit_changed(ui_number_t *item, uint32_t digit, char glyph, bool highlight, bool full)
+{
+    char drawn = glyph | (highlight ? 0x80 : 0);
+    if (digit >= UI_NUMBER_MAX_DIGITS) {
+        return true;
+    }
+    if (!full && item->drawn[digit] == drawn) {
+        return false;
+    }
+    item->drawn[digit] = drawn;
+    return true;
+}
+
 static void number_draw(ui_item_t *_item)
 {
     ui_number_t *item = (ui_number_t*) _item;
@@ -229,6 +255,9 @@ static void number_draw(ui_item_t *_item)
     uint16_t color = item->color;
     uint32_t cur_digit = item->num_digits + item->num_decimals - 1; /** Which digit are we currently drawing? 0 is the right most digit */
 
+    /** Redraw everything if the screen was overwritten since we last drew */
+    bool full = item->drawn_generation != tft_get_generation() || item->drawn_color != color;
+
     /** Adjust drawing position if right aligned */
     if (item->alignment == ui_text_right_aligned)
         xpos -= number_draw_width(_item);
@@ -252,24 +281,28 @@ static void number_draw(ui_item_t *_item)
         // digit selected
         bool highlight = _item->has_focus && item->cur_digit == cur_digit;
 
-        // Draw background either black, or a highlighted box
-        if (spacing > 1) {
-            if (highlight) {
-                tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, WHITE);
-            } else {
-                tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, BLACK);
-            }
-        }
-
         // Draw the digit, Only if:
         //   value >= this place's min value (ie. digit's power)
         //   in one's place (ensuring 0.xxx has leading 0)
         //   or item has focus (ensures all digits are drawn when focused)
-        if (item->value >= power || place == 1 || _item->has_focus) {
-            // ASCII '0' plus digit value for digit ascii offset
-            tft_putch(item->font_size, '0' + digit, xpos, _item->y, digit_w, h, color, highlight);
-        } else {
-            tft_fill(xpos, _item->y, digit_w, h, BLACK);
+        bool visible = item->value >= power || place == 1 || _item->has_focus;
+
+        if (number_digit_changed(item, cur_digit, visible ? '0' + digit : 0, highlight, full)) {
+            // Draw background either black, or a highlighted box
+            if (spacing > 1) {
+                if (highlight) {
+                    tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, WHITE);
+                } else {
+                    tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, BLACK);
+                }
+            }
+
+            if (visible) {
+                // ASCII '0' plus digit value for digit ascii offset
+                tft_putch(item->font_size, '0' + digit, xpos, _item->y, digit_w, h, color, highlight);
+            } else {
+                tft_fill(xpos, _item->y, digit_w, h, BLACK);
+            }
         }
 
         // next digit position
@@ -278,7 +311,9 @@ static void number_draw(ui_item_t *_item)
 
     /** Draw the decimal point if there are decimal places */
     if (item->num_decimals) {
-        tft_putch(item->font_size, '.', xpos, _item->y, dot_width, h, color, false);
+        if (full) {
+            tft_putch(item->font_size, '.', xpos, _item->y, dot_width, h, color, false);
+        }
         xpos += dot_width + spacing;
     }
 
@@ -287,34 +322,41 @@ static void number_draw(ui_item_t *_item)
     for (uint32_t i = 0; i < item->num_decimals; ++i) {
         bool highlight = _item->has_focus && item->cur_digit == cur_digit;
         uint8_t digit = item->value / my_pow(10, (item->si_prefix * -1) -1 - i) % 10;
-        if (spacing > 1) /** Dont frame tiny fonts */
-        {
-            if (highlight) /** Draw an extra pixel wide border around the highlighted item */
-                tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, WHITE);
-            else
-                tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, BLACK);
+        if (number_digit_changed(item, cur_digit, '0' + digit, highlight, full)) {
+            if (spacing > 1) /** Dont frame tiny fonts */
+            {
+                if (highlight) /** Draw an extra pixel wide border around the highlighted item */
+                    tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, WHITE);
+                else
+                    tft_rect(xpos-1, _item->y-1, digit_w+1, h+1, BLACK);
+            }
+            tft_putch(item->font_size, '0' + digit, xpos, _item->y, digit_w, h, color, highlight);
         }
-        tft_putch(item->font_size, '0' + digit, xpos, _item->y, digit_w, h, color, highlight);
         cur_digit--;
         xpos += digit_w + spacing;
     }
 
-    /** The unit */
-    switch(item->unit) {
-        case unit_none:
-            break;
-        case unit_volt:
-            tft_putch(item->font_size, 'V', xpos, _item->y, max_w, h, color, false);
-            break;
-        case unit_ampere:
-            tft_putch(item->font_size, 'A', xpos, _item->y, max_w, h, color, false);
-            break;
-        case unit_hertz:
-            tft_puts(FONT_FULL_SMALL, "Hz", xpos, _item->y + h, FONT_FULL_SMALL_MAX_GLYPH_WIDTH * 2, FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, color, false);
-            break;
-        default:
-            assert(0);
+    /** The unit never changes */
+    if (full) {
+        switch(item->unit) {
+            case unit_none:
+                break;
+            case unit_volt:
+                tft_putch(item->font_size, 'V', xpos, _item->y, max_w, h, color, false);
+                break;
+            case unit_ampere:
+                tft_putch(item->font_size, 'A', xpos, _item->y, max_w, h, color, false);
+                break;
+            case unit_hertz:
+                tft_puts(FONT_FULL_SMALL, "Hz", xpos, _item->y + h, FONT_FULL_SMALL_MAX_GLYPH_WIDTH * 2, FONT_FULL_SMALL_MAX_GLYPH_HEIGHT, color, false);
+                break;
+            default:
+                assert(0);
+        }
     }
+
+    item->drawn_generation = tft_get_generation();
+    item->drawn_color = color;
 }
 
 /**
@@ -330,5 +372,38 @@ void number_init(ui_number_t *item)
     item->ui.get_value = &number_get_value;
     item->ui.draw = &number_draw;
     item->cur_digit = item->num_digits + item->num_decimals - 1; /** Most signinficant digit */
+    item->drawn_generation = 0;
     item->ui.needs_redraw = true;
 }
+
+/**
+ * @brief      Update the item with a measured value, only values that change
+ *             the displayed digits are redrawn and redraws are further
+ *             limited by min_change and min_interval_ms
+ *
+ * @param      item   The item
+ * @param[in]  value  The measured value
+ *
+ * @return     true if the item was redrawn
+ */
+bool number_update(ui_number_t *item, int32_t value)
+{
+    assert(item);
+    uint32_t now = (uint32_t) get_ticks();
+    if (item->drawn_generation == tft_get_generation()) {
+        uint32_t min_interval = item->min_interval_ms ? item->min_interval_ms : UI_NUMBER_MIN_INTERVAL_MS;
+        /** One step of the last displayed digit, number_draw truncates the
+            digits below it */
+        int32_t lsb_exponent = (item->si_prefix * -1) - item->num_decimals;
+        int32_t lsb = lsb_exponent > 0 ? (int32_t) my_pow(10, lsb_exponent) : 1;
+        if (value / lsb == item->value / lsb ||
+            (uint32_t) abs(value - item->value) < item->min_change ||
+            now - item->updated_at < min_interval) {
+            return false;
+        }
+    }
+    item->value = value;
+    item->updated_at = now;
+    item->ui.draw(&item->ui);
+    return true;
+}
@@ -31,6 +31,12 @@
 #include "tft.h"
 #include "uui.h"
 
+/** Max number of digits (including decimals) for which drawn glyphs are tracked */
+#define UI_NUMBER_MAX_DIGITS  (8)
+
+/** Default min time between redraws of a measured value, see number_update */
+#define UI_NUMBER_MIN_INTERVAL_MS  (100)
+
 /**
  * A UI item describing an editable number formatted as <num_digits>.<num_decimals>
  * The number has a min and max value and cur_digit keeps track of which digit
@@ -52,6 +58,14 @@ typedef struct ui_number_t {
     int32_t min;
     int32_t max;
     void (*changed)(struct ui_number_t *item);
+    /** Limits for redrawing measured values with number_update */
+    uint16_t min_change; /** Extra hysteresis, smallest change of value that is redrawn, 0 for none */
+    uint16_t min_interval_ms; /** Min time between redraws, 0 for UI_NUMBER_MIN_INTERVAL_MS */
+    uint32_t updated_at; /** Time of the last redraw by number_update */
+    /** What is currently on screen, only changed digits are redrawn */
+    uint32_t drawn_generation; /** tft generation of the last draw, 0 if never drawn */
+    uint16_t drawn_color;
+    char drawn[UI_NUMBER_MAX_DIGITS]; /** Glyph per digit (0 is the right most), 0 if blanked, bit 7 set if highlighted */
 } ui_number_t;
 
 /**
@@ -61,4 +75,17 @@ typedef struct ui_number_t {
  */
 void number_init(ui_number_t *item);
 
+/**
+ * @brief      Update the item with a measured value. The item is redrawn if the
+ *             displayed digits change, the value moved by at least min_change
+ *             since it was last drawn and at least min_interval_ms has passed
+ *             since the last update, or if the screen has been overwritten.
+ *
+ * @param      item   The item
+ * @param[in]  value  The measured value
+ *
+ * @return     true if the item was redrawn
+ */
+bool number_update(ui_number_t *item, int32_t value);
+
 #endif // __UUI_NUMBER_H__